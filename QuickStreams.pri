@@ -9,9 +9,14 @@ HEADERS += \
 	$$PWD/src/Provider.hpp \
 	$$PWD/src/QmlProvider.hpp \
 	$$PWD/src/LambdaExecutable.hpp \
+	$$PWD/src/CombinatorExecutable.hpp \
+	$$PWD/src/MapExecutable.hpp \
+	$$PWD/src/HedgeExecutable.hpp \
+	$$PWD/src/HedgePolicy.hpp \
 	$$PWD/src/LambdaSyncExecutable.hpp \
 	$$PWD/src/LambdaWrapper.hpp \
 	$$PWD/src/JsExecutable.hpp \
+	$$PWD/src/JsMarshalling.hpp \
 	$$PWD/src/JsSyncExecutable.hpp \
 	$$PWD/src/QmlStream.hpp \
 	$$PWD/src/LambdaRepeater.hpp \
@@ -23,10 +28,23 @@ HEADERS += \
 	$$PWD/src/QmlStreamHandle.hpp \
 	$$PWD/src/Repeater.hpp \
 	$$PWD/src/ProviderInterface.hpp \
+	$$PWD/src/Transition.hpp \
+	$$PWD/src/StreamPool.hpp \
+	$$PWD/src/SequenceTemplate.hpp \
+	$$PWD/src/TypedStream.hpp \
+	$$PWD/src/Scheduler.hpp \
+	$$PWD/src/SharedQueueScheduler.hpp \
+	$$PWD/src/WorkStealingScheduler.hpp \
+	$$PWD/src/TimerWheel.hpp \
+	$$PWD/src/ShardedCounter.hpp \
 	$$PWD/src/Retryer.hpp \
 	$$PWD/src/LambdaRetryer.hpp \
 	$$PWD/src/TypeRetryer.hpp \
+	$$PWD/src/BackoffRetryer.hpp \
+	$$PWD/src/CircuitBreaker.hpp \
 	$$PWD/src/Error.hpp \
+	$$PWD/src/ExceptionTranslator.hpp \
+	$$PWD/src/ErrorMatcher.hpp \
 	$$PWD/src/JsTypeRetryer.hpp \
 	$$PWD/src/JsConditionRetryer.hpp
 
@@ -34,11 +52,23 @@ SOURCES += \
 	$$PWD/src/Stream.cpp \
 	$$PWD/src/StreamHandle.cpp \
 	$$PWD/src/Provider.cpp \
+	$$PWD/src/StreamPool.cpp \
+	$$PWD/src/SequenceTemplate.cpp \
+	$$PWD/src/Scheduler.cpp \
+	$$PWD/src/SharedQueueScheduler.cpp \
+	$$PWD/src/WorkStealingScheduler.cpp \
+	$$PWD/src/TimerWheel.cpp \
+	$$PWD/src/ShardedCounter.cpp \
 	$$PWD/src/QmlProvider.cpp \
 	$$PWD/src/LambdaExecutable.cpp \
+	$$PWD/src/CombinatorExecutable.cpp \
+	$$PWD/src/MapExecutable.cpp \
+	$$PWD/src/HedgeExecutable.cpp \
+	$$PWD/src/HedgePolicy.cpp \
 	$$PWD/src/LambdaSyncExecutable.cpp \
 	$$PWD/src/LambdaWrapper.cpp \
 	$$PWD/src/JsExecutable.cpp \
+	$$PWD/src/JsMarshalling.cpp \
 	$$PWD/src/JsSyncExecutable.cpp \
 	$$PWD/src/QmlStream.cpp \
 	$$PWD/src/LambdaRepeater.cpp \
@@ -50,7 +80,11 @@ SOURCES += \
 	$$PWD/src/Retryer.cpp \
 	$$PWD/src/LambdaRetryer.cpp \
 	$$PWD/src/TypeRetryer.cpp \
+	$$PWD/src/BackoffRetryer.cpp \
+	$$PWD/src/CircuitBreaker.cpp \
 	$$PWD/src/Error.cpp \
+	$$PWD/src/ExceptionTranslator.cpp \
+	$$PWD/src/ErrorMatcher.cpp \
 	$$PWD/src/JsTypeRetryer.cpp \
 	$$PWD/src/JsConditionRetryer.cpp
 
@@ -112,7 +112,11 @@ Item {
 			var chain = mainStream.adopt(filesystem.allocateFile())
 
 			// Indefinitely retry file allocation in case of timeout errors
-			.retry([filesystem.TimeoutError])
+			// backing off for up to 2 seconds to relieve the filesystem
+			.retry([filesystem.TimeoutError], -1, {
+				initialDelay: 50,
+				maxDelay: 2000
+			})
 
 			// Bind this asynchronous operation, it should be executed
 			// no matter whether the chain was aborted in the meantime or not.
@@ -140,7 +144,11 @@ Item {
 			})
 
 			// Indefinitely retry writing chunks in case of timeout errors
-			.retry([filesystem.TimeoutError])
+			// backing off for up to 2 seconds to relieve the filesystem
+			.retry([filesystem.TimeoutError], -1, {
+				initialDelay: 50,
+				maxDelay: 2000
+			})
 
 			// Repeat writing until all chunks are written.
 			// Write operations are atomic streams and will repeat even
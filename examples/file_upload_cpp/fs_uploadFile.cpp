@@ -52,7 +52,11 @@ Stream::Reference Filesystem::uploadFile(int fileSize, int chunkSize) {
 			mainStream.adopt(allocateFile())
 
 			// Indefinitely retry allocation in case of timeout errors
-			->retry({(int)Error::TimeoutError})
+			// backing off for up to 2 seconds to relieve the filesystem
+			->retry(
+				{(int)Error::TimeoutError},
+				BackoffRetryer::Policy(50, 2000)
+			)
 
 			// Bind this asynchronous operation, it should be executed
 			// no matter whether the chain was aborted in the meantime or not.
@@ -82,7 +86,11 @@ Stream::Reference Filesystem::uploadFile(int fileSize, int chunkSize) {
 			}))
 
 			// Indefinitely retry writing chunks in case of timeout errors
-			->retry({(int)Error::TimeoutError})
+			// backing off for up to 2 seconds to relieve the filesystem
+			->retry(
+				{(int)Error::TimeoutError},
+				BackoffRetryer::Policy(50, 2000)
+			)
 
 			// Repeat writing until all chunks are written.
 			// Write operations are atomic streams and will repeat even
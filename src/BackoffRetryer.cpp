@@ -0,0 +1,70 @@
+#include "Retryer.hpp"
+#include "BackoffRetryer.hpp"
+#include <cmath>
+#include <QVariant>
+#include <QRandomGenerator>
+
+quickstreams::BackoffRetryer::Policy::Policy(
+	qint32 initialDelay,
+	qint32 maxDelay,
+	Jitter jitter,
+	double multiplier
+) :
+	initialDelay(initialDelay < 0 ? 0 : initialDelay),
+	maxDelay(maxDelay < initialDelay ? initialDelay : maxDelay),
+	jitter(jitter),
+	multiplier(multiplier < 1.0 ? 1.0 : multiplier)
+{}
+
+quickstreams::BackoffRetryer::BackoffRetryer(
+	const Retryer::Reference& condition,
+	const Policy& policy,
+	qint32 maxTrials
+) :
+	Retryer(maxTrials),
+	_condition(condition),
+	_policy(policy),
+	_previousDelay(policy.initialDelay)
+{}
+
+void quickstreams::BackoffRetryer::reset() {
+	Retryer::reset();
+	_previousDelay = _policy.initialDelay;
+}
+
+bool quickstreams::BackoffRetryer::verifyCondition(const QVariant& error) {
+	if(_condition.isNull()) return true;
+	return _condition->verifyCondition(error);
+}
+
+qint32 quickstreams::BackoffRetryer::backoff() {
+	const double initial(_policy.initialDelay);
+	const double max(_policy.maxDelay);
+	double delay(0);
+
+	switch(_policy.jitter) {
+	case Jitter::Decorrelated: {
+		// The upper bound grows from the previous delay
+		// rather than from the number of trials
+		double upper(qMin(max, _previousDelay * _policy.multiplier));
+		if(upper < initial) upper = initial;
+		delay = initial + QRandomGenerator::global()->generateDouble() * (
+			upper - initial
+		);
+		break;
+	}
+	default: {
+		// The exponent is capped to avoid overflowing
+		// long before the maximum delay is reached anyway
+		const int exponent(qMin(_currentTrial - 1, 62));
+		delay = qMin(max, initial * std::pow(_policy.multiplier, exponent));
+		if(_policy.jitter == Jitter::Full) {
+			delay *= QRandomGenerator::global()->generateDouble();
+		}
+		break;
+	}
+	}
+
+	_previousDelay = delay;
+	return qint32(delay);
+}
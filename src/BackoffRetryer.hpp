@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Retryer.hpp"
+#include <QVariant>
+
+namespace quickstreams {
+
+// The backoff retryer retries on the condition of another retryer
+// but backs off for an exponentially growing, optionally jittered
+// amount of time before each retrial instead of retrying right away
+class BackoffRetryer : public Retryer {
+public:
+	enum class Jitter : char {
+		// Backs off for exactly the exponential delay
+		None,
+
+		// Backs off for a random delay between 0 and the exponential delay
+		Full,
+
+		// Backs off for a random delay between the initial delay
+		// and the previous delay multiplied by the multiplier
+		Decorrelated
+	};
+
+	struct Policy {
+		qint32 initialDelay;
+		qint32 maxDelay;
+		Jitter jitter;
+		double multiplier;
+
+		Policy(
+			qint32 initialDelay = 100,
+			qint32 maxDelay = 10000,
+			Jitter jitter = Jitter::Full,
+			double multiplier = 2.0
+		);
+	};
+
+protected:
+	Retryer::Reference _condition;
+	Policy _policy;
+	double _previousDelay;
+
+public:
+	// A null condition retries on any error
+	BackoffRetryer(
+		const Retryer::Reference& condition,
+		const Policy& policy,
+		qint32 maxTrials = -1
+	);
+	void reset();
+	bool verifyCondition(const QVariant& error);
+	qint32 backoff();
+};
+
+} // quickstreams
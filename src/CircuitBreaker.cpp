@@ -0,0 +1,156 @@
+#include "CircuitBreaker.hpp"
+#include <QString>
+#include <QVector>
+
+quickstreams::CircuitBreaker::Policy::Policy(
+	int windowSize,
+	double failureRateThreshold,
+	qint32 openDuration,
+	int halfOpenProbes,
+	int minimumCalls
+) :
+	windowSize(windowSize < 1 ? 1 : windowSize),
+	failureRateThreshold(failureRateThreshold),
+	openDuration(openDuration < 0 ? 0 : openDuration),
+	halfOpenProbes(halfOpenProbes < 1 ? 1 : halfOpenProbes),
+	minimumCalls(minimumCalls < 1 ? 1 : minimumCalls)
+{}
+
+quickstreams::CircuitBreaker::Permit::Permit(Kind kind, quint32 epoch) :
+	kind(kind),
+	epoch(epoch)
+{}
+
+quickstreams::CircuitBreaker::CircuitBreaker(
+	const QString& name,
+	const Policy& policy
+) :
+	_name(name),
+	_openMessage(QString("circuit breaker %1 is open").arg(name)),
+	_policy(policy),
+	_state(State::Closed),
+	_epoch(0),
+	_window(policy.windowSize, false),
+	_next(0),
+	_recorded(0),
+	_failures(0),
+	_probes(0),
+	_probeSuccesses(0),
+	_openedAt(0)
+{
+	_clock.start();
+}
+
+void quickstreams::CircuitBreaker::open() {
+	_state = State::Open;
+	++_epoch;
+	_openedAt = _clock.elapsed();
+	_probes = 0;
+	_probeSuccesses = 0;
+}
+
+void quickstreams::CircuitBreaker::close() {
+	// Start over with an empty window
+	_state = State::Closed;
+	++_epoch;
+	_window.fill(false);
+	_next = 0;
+	_recorded = 0;
+	_failures = 0;
+	_probes = 0;
+	_probeSuccesses = 0;
+}
+
+void quickstreams::CircuitBreaker::record(bool failure) {
+	// Overwrite the oldest outcome once the window is full
+	if(_recorded < _window.size()) {
+		_recorded++;
+	} else if(_window[_next]) {
+		_failures--;
+	}
+	_window[_next] = failure;
+	if(failure) _failures++;
+	_next = (_next + 1) % _window.size();
+
+	if(
+		_recorded >= _policy.minimumCalls
+		&& failureRate() >= _policy.failureRateThreshold
+	) open();
+}
+
+quickstreams::CircuitBreaker::Permit quickstreams::CircuitBreaker::acquire() {
+	switch(state()) {
+	case State::Closed:
+		return Permit(Permit::Kind::Call, _epoch);
+	case State::Open:
+		return Permit(Permit::Kind::Rejected, _epoch);
+	case State::HalfOpen:
+		_state = State::HalfOpen;
+		if(_probes + _probeSuccesses >= _policy.halfOpenProbes) {
+			return Permit(Permit::Kind::Rejected, _epoch);
+		}
+		_probes++;
+		return Permit(Permit::Kind::Probe, _epoch);
+	}
+	return Permit(Permit::Kind::Rejected, _epoch);
+}
+
+void quickstreams::CircuitBreaker::release(Permit permit, Outcome outcome) {
+	// Permits acquired before the breaker last opened or closed
+	// must not affect the current period
+	if(permit.epoch != _epoch) return;
+
+	switch(permit.kind) {
+	case Permit::Kind::Call:
+		// Outcomes of calls permitted before the breaker opened
+		// don't affect the open or half-open breaker
+		if(_state != State::Closed || outcome == Outcome::Canceled) return;
+		record(outcome == Outcome::Failure);
+		break;
+	case Permit::Kind::Probe:
+		if(_state != State::HalfOpen) return;
+		_probes--;
+		switch(outcome) {
+		case Outcome::Failure:
+			open();
+			break;
+		case Outcome::Success:
+			_probeSuccesses++;
+			if(_probeSuccesses >= _policy.halfOpenProbes) close();
+			break;
+		default:
+			// A canceled probe frees its place for another probe
+			break;
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+QString quickstreams::CircuitBreaker::name() const {
+	return _name;
+}
+
+QString quickstreams::CircuitBreaker::openMessage() const {
+	return _openMessage;
+}
+
+const quickstreams::CircuitBreaker::Policy&
+quickstreams::CircuitBreaker::policy() const {
+	return _policy;
+}
+
+quickstreams::CircuitBreaker::State
+quickstreams::CircuitBreaker::state() const {
+	if(
+		_state == State::Open
+		&& _clock.elapsed() - _openedAt >= _policy.openDuration
+	) return State::HalfOpen;
+	return _state;
+}
+
+double quickstreams::CircuitBreaker::failureRate() const {
+	if(_recorded < 1) return 0;
+	return double(_failures) / double(_recorded);
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <QElapsedTimer>
+#include <QSharedPointer>
+
+namespace quickstreams {
+
+// The circuit breaker guards a downstream dependency shared by many streams.
+// It tracks the outcomes of the most recent calls in a sliding window
+// and opens when the failure rate exceeds the threshold. While open
+// all calls are rejected to fail fast. After the open duration it turns
+// half-open letting a limited number of probes through. It closes
+// when all probes succeed and opens again as soon as any probe fails.
+// Circuit breakers must only be used on the provider thread.
+class CircuitBreaker {
+public:
+	typedef QSharedPointer<CircuitBreaker> Reference;
+
+	enum class State : char {Closed, Open, HalfOpen};
+
+	// A permit is acquired for each call and released with its outcome.
+	// Permits are bound to the closed or half-open period they were
+	// acquired in and are ignored when released in a later period
+	struct Permit {
+		enum class Kind : char {None, Rejected, Call, Probe};
+
+		Kind kind;
+		quint32 epoch;
+
+		Permit(Kind kind = Kind::None, quint32 epoch = 0);
+	};
+
+	enum class Outcome : char {Success, Failure, Canceled};
+
+	struct Policy {
+		// Number of most recent call outcomes the failure rate is based on
+		int windowSize;
+
+		// Failure rate between 0 and 1 opening the breaker
+		double failureRateThreshold;
+
+		// Number of milliseconds the breaker remains open
+		qint32 openDuration;
+
+		// Number of probes let through while half-open
+		int halfOpenProbes;
+
+		// Minimum number of recorded calls to evaluate the failure rate
+		int minimumCalls;
+
+		Policy(
+			int windowSize = 20,
+			double failureRateThreshold = 0.5,
+			qint32 openDuration = 5000,
+			int halfOpenProbes = 1,
+			int minimumCalls = 10
+		);
+	};
+
+protected:
+	QString _name;
+
+	// Shared by the errors of all rejected calls
+	QString _openMessage;
+	Policy _policy;
+	State _state;
+
+	// Incremented whenever the breaker opens or closes
+	quint32 _epoch;
+
+	// Ring buffer of the most recent outcomes, true for failures
+	QVector<bool> _window;
+	int _next;
+	int _recorded;
+	int _failures;
+
+	int _probes;
+	int _probeSuccesses;
+	QElapsedTimer _clock;
+	qint64 _openedAt;
+
+	void open();
+	void close();
+	void record(bool failure);
+
+public:
+	CircuitBreaker(const QString& name, const Policy& policy = Policy());
+
+	CircuitBreaker(const CircuitBreaker&) = delete;
+	CircuitBreaker& operator=(const CircuitBreaker&) = delete;
+
+	// Returns Rejected if the call must fail fast,
+	// otherwise returns the permit to release when the call settled
+	Permit acquire();
+
+	// Releases the permit reporting the outcome of the call
+	void release(Permit permit, Outcome outcome);
+
+	QString name() const;
+	const Policy& policy() const;
+
+	// Returns the message of the errors of rejected calls
+	QString openMessage() const;
+
+	// Returns the current state, an open breaker
+	// is reported half-open once the open duration elapsed
+	State state() const;
+
+	// Returns the failure rate within the sliding window
+	double failureRate() const;
+};
+
+} // quickstreams
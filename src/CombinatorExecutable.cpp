@@ -0,0 +1,157 @@
+#include "CombinatorExecutable.hpp"
+#include "Stream.hpp"
+#include "Error.hpp"
+#include <QObject>
+#include <QVariant>
+#include <QVariantList>
+#include <QString>
+
+quickstreams::CombinatorExecutable::CombinatorExecutable(
+	Mode mode,
+	const Members& members
+) :
+	_mode(mode),
+	_members(members)
+{}
+
+void quickstreams::CombinatorExecutable::onClosed(
+	const AggregationReference& aggregation,
+	int index,
+	const QVariant& data
+) {
+	if(aggregation->settled) return;
+
+	switch(aggregation->mode) {
+	case Mode::All:
+		aggregation->results[index] = data;
+		if(--aggregation->pending > 0) return;
+		settle(aggregation, -1);
+		aggregation->handle.close(aggregation->results);
+		break;
+	default:
+		settle(aggregation, index);
+		aggregation->handle.close(data);
+		break;
+	}
+}
+
+void quickstreams::CombinatorExecutable::onFailed(
+	const AggregationReference& aggregation,
+	int index,
+	const QVariant& error
+) {
+	if(aggregation->settled) return;
+
+	// Any only fails if there's no member left to close
+	if(aggregation->mode == Mode::Any && --aggregation->pending > 0) return;
+
+	settle(aggregation, index);
+	aggregation->handle.fail(error);
+}
+
+void quickstreams::CombinatorExecutable::onAborted(
+	const AggregationReference& aggregation,
+	int index,
+	const QVariant& reason
+) {
+	if(aggregation->settled) return;
+
+	if(aggregation->handle.isAborted()) {
+		// Wait for the other members unless the first one settles the race
+		if(
+			aggregation->mode != Mode::Race
+			&& --aggregation->pending > 0
+		) return;
+		settle(aggregation, index);
+
+		// Closing the aborted combinator awakes its abortion sequence
+		aggregation->handle.close(reason);
+		return;
+	}
+
+	onFailed(aggregation, index, QVariant::fromValue<Error>(Error(
+		exception::Exception::type(),
+		QString("combined stream %1 was aborted").arg(index)
+	)));
+}
+
+void quickstreams::CombinatorExecutable::settle(
+	const AggregationReference& aggregation,
+	int winner
+) {
+	aggregation->settled = true;
+
+	// Abort the losers
+	for(int itr(0); itr < aggregation->members.size(); ++itr) {
+		if(itr == winner) continue;
+		auto member(aggregation->members.at(itr).toStrongRef());
+		if(!member.isNull()) member->abort();
+	}
+	aggregation->members.clear();
+}
+
+void quickstreams::CombinatorExecutable::execute(const QVariant& data) {
+	// Settle right away if there's nothing to combine
+	if(_members.isEmpty()) {
+		if(_mode == Mode::All) _handle->close(QVariantList());
+		else _handle->close(QVariant());
+		return;
+	}
+
+	AggregationReference aggregation(new Aggregation{
+		*_handle,
+		_mode,
+		QVector<QWeakPointer<Stream>>(),
+		QVariantList(),
+		_members.size(),
+		false
+	});
+	for(int itr(0); itr < _members.size(); ++itr) {
+		aggregation->members.append(_members.at(itr).toWeakRef());
+		aggregation->results.append(QVariant());
+	}
+
+	// Observe the members before launching them
+	for(int itr(0); itr < _members.size(); ++itr) {
+		auto member(_members.at(itr).data());
+		QObject::connect(
+			member, &Stream::closed,
+			member, [aggregation, itr](
+				QVariant data, Stream::WakeCondition wakeCondition
+			) {
+				// Aborted members never close successfully
+				if(
+					wakeCondition == Stream::WakeCondition::Abort
+					|| wakeCondition == Stream::WakeCondition::AbortNoDelay
+				) {
+					onAborted(aggregation, itr, data);
+					return;
+				}
+				onClosed(aggregation, itr, data);
+			}
+		);
+		QObject::connect(
+			member, &Stream::failed,
+			member, [aggregation, itr](
+				QVariant error, Stream::WakeCondition wakeCondition
+			) {
+				Q_UNUSED(wakeCondition)
+				onFailed(aggregation, itr, error);
+			}
+		);
+		QObject::connect(
+			member, &Stream::aborted,
+			member, [aggregation, itr](
+				QVariant reason, Stream::WakeCondition wakeCondition
+			) {
+				Q_UNUSED(wakeCondition)
+				onAborted(aggregation, itr, reason);
+			}
+		);
+	}
+
+	// Launch all members passing them the data this stream was awoken with
+	for(int itr(0); itr < _members.size(); ++itr) {
+		_members.at(itr)->launch(data);
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Executable.hpp"
+#include "StreamHandle.hpp"
+#include "Stream.hpp"
+#include <QList>
+#include <QVector>
+#include <QVariant>
+#include <QVariantList>
+#include <QSharedPointer>
+#include <QWeakPointer>
+
+namespace quickstreams {
+
+class Provider;
+
+// The combinator executable launches its member streams concurrently
+// when executed and settles the stream it belongs to depending on how
+// the members settle. Members that lost the race are aborted.
+// Aborting the combinator aborts all members.
+class CombinatorExecutable : public Executable {
+	friend class Provider;
+
+public:
+	enum class Mode : char {
+		// Closes with the list of the close data of all members
+		// in the order of the members, fails as soon as any member fails
+		All,
+
+		// Closes with the close data of the first member to close,
+		// fails with the error of the last member if all members fail
+		Any,
+
+		// Closes or fails just like the first member to settle
+		Race
+	};
+
+	typedef QList<Stream::Reference> Members;
+
+protected:
+	// The aggregation outlives the executable for the observers
+	// of the members to remain safe even if the combinator died
+	struct Aggregation {
+		StreamHandle handle;
+		Mode mode;
+		QVector<QWeakPointer<Stream>> members;
+		QVariantList results;
+		int pending;
+		bool settled;
+	};
+	typedef QSharedPointer<Aggregation> AggregationReference;
+
+	Mode _mode;
+	Members _members;
+
+	CombinatorExecutable(Mode mode, const Members& members);
+
+	static void onClosed(
+		const AggregationReference& aggregation,
+		int index,
+		const QVariant& data
+	);
+	static void onFailed(
+		const AggregationReference& aggregation,
+		int index,
+		const QVariant& error
+	);
+
+	// Members of an aborted combinator settle it into its abortion
+	// sequence once all of them settled, members aborted from outside
+	// can never close and are considered failed
+	static void onAborted(
+		const AggregationReference& aggregation,
+		int index,
+		const QVariant& reason
+	);
+
+	// Marks the aggregation as settled and aborts all members
+	// except the given winner
+	static void settle(const AggregationReference& aggregation, int winner);
+
+public:
+	void execute(const QVariant& data);
+};
+
+} // quickstreams
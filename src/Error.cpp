@@ -2,12 +2,17 @@
 #include <exception>
 #include <future>
 #include <regex>
+#include <stdexcept>
 #include <QObject>
 #include <QString>
 #include <QVariant>
 #include <QJSValue>
 #include <QCoreApplication>
 #include <QMetaType>
+#include <QHash>
+#include <QReadWriteLock>
+#include <QReadLocker>
+#include <QWriteLocker>
 
 quickstreams::exception::Exception::Exception() : QObject(nullptr) {}
 quickstreams::exception::Exception::Exception(const QString& msg) :
@@ -168,6 +173,32 @@ std::error_code quickstreams::exception::SystemError::code() const {
 	return _code;
 }
 
+quickstreams::exception::TimeoutError::TimeoutError() : _duration(0) {}
+quickstreams::exception::TimeoutError::TimeoutError(
+	const QString &msg,
+	qint32 duration
+) :
+	RuntimeError(msg),
+	_duration(duration)
+{}
+
+qint32 quickstreams::exception::TimeoutError::duration() const {
+	return _duration;
+}
+
+quickstreams::exception::CircuitOpenError::CircuitOpenError() {}
+quickstreams::exception::CircuitOpenError::CircuitOpenError(
+	const QString &msg,
+	const QString &breaker
+) :
+	RuntimeError(msg),
+	_breaker(breaker)
+{}
+
+QString quickstreams::exception::CircuitOpenError::breaker() const {
+	return _breaker;
+}
+
 // Types
 int quickstreams::exception::Exception::type() {
 	return qMetaTypeId<quickstreams::exception::Exception*>();
@@ -253,43 +284,228 @@ int quickstreams::exception::SystemError::type() {
 	return qMetaTypeId<quickstreams::exception::SystemError*>();
 }
 
-quickstreams::Error::Error(exception::Exception* instance) {
+int quickstreams::exception::TimeoutError::type() {
+	return qMetaTypeId<quickstreams::exception::TimeoutError*>();
+}
+
+int quickstreams::exception::CircuitOpenError::type() {
+	return qMetaTypeId<quickstreams::exception::CircuitOpenError*>();
+}
+
+// Returns the meta type identifier of the exception class
+static int exceptionType(const quickstreams::exception::Exception* instance) {
+	auto meta(instance->metaObject());
+	if(!meta) return QMetaType::Void;
+	QString name(meta->className());
+	name += '*';
+	return QMetaType::type(name.toLatin1());
+}
+
+// Returns the code of the exception as described by compact errors
+static qint64 exceptionCode(
+	int type,
+	const quickstreams::exception::Exception* instance
+) {
+	using namespace quickstreams::exception;
+	if(type == FutureError::type()) {
+		return static_cast<const FutureError*>(instance)->code().value();
+	}
+	if(type == RegexError::type()) {
+		return static_cast<const RegexError*>(instance)->code();
+	}
+	if(type == SystemError::type()) {
+		return static_cast<const SystemError*>(instance)->code().value();
+	}
+	if(type == TimeoutError::type()) {
+		return static_cast<const TimeoutError*>(instance)->duration();
+	}
+	return 0;
+}
+
+// Creates the exception object of the given built-in type,
+// returns null if the type isn't built-in
+static quickstreams::exception::Exception* createBuiltIn(
+	int type,
+	const QString& msg,
+	qint64 code,
+	const QString& detail
+) {
+	using namespace quickstreams::exception;
+	if(type == InvalidArgument::type()) return new InvalidArgument(msg);
+	if(type == DomainError::type()) return new DomainError(msg);
+	if(type == LengthError::type()) return new LengthError(msg);
+	if(type == OutOfRange::type()) return new OutOfRange(msg);
+	if(type == FutureError::type()) return new FutureError(
+		std::make_error_code(std::future_errc(code))
+	);
+	if(type == LogicError::type()) return new LogicError(msg);
+	if(type == RangeError::type()) return new RangeError(msg);
+	if(type == OverflowError::type()) return new OverflowError(msg);
+	if(type == UnderflowError::type()) return new UnderflowError(msg);
+	if(type == RegexError::type()) return new RegexError(
+		std::regex_constants::error_type(code)
+	);
+	if(type == SystemError::type()) return new SystemError(
+		msg, std::error_code(int(code), std::system_category())
+	);
+	if(type == TimeoutError::type()) return new TimeoutError(
+		msg, qint32(code)
+	);
+	if(type == CircuitOpenError::type()) return new CircuitOpenError(
+		msg, detail
+	);
+	if(type == RuntimeError::type()) return new RuntimeError(msg);
+	if(type == BadTypeId::type()) return new BadTypeId(msg);
+	if(type == BadCast::type()) return new BadCast(msg);
+	if(type == BadWeakPtr::type()) return new BadWeakPtr(msg);
+	if(type == BadFunctionCall::type()) return new BadFunctionCall(msg);
+	if(type == BadArrayNewLength::type()) return new BadArrayNewLength(msg);
+	if(type == BadAlloc::type()) return new BadAlloc(msg);
+	if(type == BadException::type()) return new BadException(msg);
+	if(type == Exception::type()) return new Exception(msg);
+	return nullptr;
+}
+
+// Returns true if compact errors of the given type are built-in
+static bool isBuiltIn(int type) {
+	using namespace quickstreams::exception;
+	return type == InvalidArgument::type()
+		|| type == DomainError::type()
+		|| type == LengthError::type()
+		|| type == OutOfRange::type()
+		|| type == FutureError::type()
+		|| type == LogicError::type()
+		|| type == RangeError::type()
+		|| type == OverflowError::type()
+		|| type == UnderflowError::type()
+		|| type == RegexError::type()
+		|| type == SystemError::type()
+		|| type == TimeoutError::type()
+		|| type == CircuitOpenError::type()
+		|| type == RuntimeError::type()
+		|| type == BadTypeId::type()
+		|| type == BadCast::type()
+		|| type == BadWeakPtr::type()
+		|| type == BadFunctionCall::type()
+		|| type == BadArrayNewLength::type()
+		|| type == BadAlloc::type()
+		|| type == BadException::type()
+		|| type == Exception::type();
+}
+
+// The factories of the registered custom exception types
+typedef QHash<int, quickstreams::Error::Factory> Factories;
+
+static QReadWriteLock& factoriesLock() {
+	static QReadWriteLock lock;
+	return lock;
+}
+
+static Factories& factories() {
+	static Factories factories;
+	return factories;
+}
+
+// Creates the exception object of the given type
+static quickstreams::exception::Exception* createException(
+	int type,
+	const QString& msg,
+	qint64 code,
+	const QString& detail
+) {
+	auto instance(createBuiltIn(type, msg, code, detail));
+	if(instance) return instance;
+	QReadLocker lock(&factoriesLock());
+	Factories::const_iterator itr(factories().constFind(type));
+	if(itr != factories().constEnd()) instance = itr.value()(msg, code);
+	if(instance) return instance;
+	return new quickstreams::exception::Exception(msg);
+}
+
+quickstreams::Error::Error(exception::Exception* instance) :
+	_type(QMetaType::Void),
+	_code(0)
+{
 	if(!instance) return;
 	_obj = Reference(instance, &exception::Exception::deleteLater);
+
+	// Resolve the type only once rather than on each inspection
+	_type = exceptionType(instance);
+	_code = exceptionCode(_type, instance);
+	_message = instance->message();
+	if(_type == exception::CircuitOpenError::type()) {
+		_detail = static_cast<exception::CircuitOpenError*>(
+			instance
+		)->breaker();
+	}
+}
+
+quickstreams::Error::Error(
+	int type,
+	const QString& message,
+	qint64 code,
+	const QString& detail
+) :
+	_type(type),
+	_code(code),
+	_message(message),
+	_detail(detail)
+{
+	if(!isRegistered(type)) throw std::logic_error(
+		"QuickStreams - FATAL ERROR: "
+		"compact error of an unregistered exception type"
+	);
+}
+
+void quickstreams::Error::registerType(int type, const Factory& factory) {
+	if(isBuiltIn(type)) throw std::logic_error(
+		"QuickStreams - FATAL ERROR: "
+		"built-in exception types can't be registered"
+	);
+	QWriteLocker lock(&factoriesLock());
+	factories().insert(type, factory);
+}
+
+bool quickstreams::Error::isRegistered(int type) {
+	if(isBuiltIn(type)) return true;
+	QReadLocker lock(&factoriesLock());
+	return factories().contains(type);
+}
+
+void quickstreams::Error::materialize() {
+	if(!_obj.isNull()) return;
+
+	// If the error doesn't describe any exception then create a default one
+	// to avoid occasional read access violations during runtime
+	_obj = Reference(
+		_type == QMetaType::Void ?
+			new exception::Exception() :
+			createException(_type, _message, _code, _detail),
+		&exception::Exception::deleteLater
+	);
 }
 
 bool quickstreams::Error::isNull() const {
-	return _obj.isNull();
+	return _type == QMetaType::Void && _obj.isNull();
 }
 
 const quickstreams::exception::Exception*
 quickstreams::Error::operator->() {
-	// If the error doesn't reference any exception then create a default one
-	// to avoid occasional read access violations during runtime
-	if(_obj.isNull()) _obj = Reference(
-		new exception::Exception(), &exception::Exception::deleteLater
-	);
+	materialize();
 	return _obj.data();
 }
 
 int quickstreams::Error::type() const {
-	if(_obj.isNull()) return QMetaType::Void;
-	auto meta(_obj->metaObject());
-	if(!meta) return QMetaType::Void;
-	QString name(meta->className());
-	name += '*';
-	return QMetaType::type(name.toLatin1());
+	return _type;
 }
 
 bool quickstreams::Error::is(int type) const {
-	return type == this->type();
+	return type == _type;
 }
 
 bool quickstreams::Error::is(const QString& name) const {
-	if(!is(quickstreams::exception::JsException::type())) return false;
-	return static_cast<quickstreams::exception::JsException*>(
-		_obj.data()
-	)->name() == name;
+	if(!is(exception::JsException::type())) return false;
+	return this->name() == name;
 }
 
 bool quickstreams::Error::is(const QJSValue& type) const {
@@ -299,15 +515,19 @@ bool quickstreams::Error::is(const QJSValue& type) const {
 }
 
 QString quickstreams::Error::name() const {
-	if(!is(quickstreams::exception::JsException::type())) return "";
+	// JavaScript errors are always backed by their exception object
+	if(_obj.isNull() || !is(exception::JsException::type())) return "";
 	return static_cast<quickstreams::exception::JsException*>(
 		_obj.data()
 	)->name();
 }
 
 QString quickstreams::Error::message() const {
-	if(_obj.isNull()) return "";
-	return _obj->message();
+	return _message;
+}
+
+qint64 quickstreams::Error::code() const {
+	return _code;
 }
 
 static void __register_quickstreams_qml_error_types() {
@@ -332,6 +552,8 @@ static void __register_quickstreams_qml_error_types() {
 	qRegisterMetaType<quickstreams::exception::UnderflowError*>();
 	qRegisterMetaType<quickstreams::exception::RegexError*>();
 	qRegisterMetaType<quickstreams::exception::SystemError*>();
+	qRegisterMetaType<quickstreams::exception::TimeoutError*>();
+	qRegisterMetaType<quickstreams::exception::CircuitOpenError*>();
 }
 
 Q_COREAPP_STARTUP_FUNCTION(__register_quickstreams_qml_error_types)
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <exception>
+#include <functional>
 #include <future>
 #include <regex>
+#include <type_traits>
 #include <QObject>
 #include <QMetaType>
 #include <QString>
@@ -316,10 +318,54 @@ public:
 	std::error_code code() const;
 };
 
+// Stream timeout, the stream didn't settle within the given duration
+class TimeoutError : public RuntimeError {
+	Q_OBJECT
+	Q_PROPERTY(int type READ type CONSTANT)
+	Q_PROPERTY(QString message READ message CONSTANT)
+	Q_PROPERTY(int duration READ duration CONSTANT)
+
+protected:
+	qint32 _duration;
+
+public:
+	static int type();
+
+	TimeoutError();
+	TimeoutError(const QString& msg, qint32 duration);
+
+	qint32 duration() const;
+};
+
+// Circuit open, the stream failed fast because its circuit breaker is open
+class CircuitOpenError : public RuntimeError {
+	Q_OBJECT
+	Q_PROPERTY(int type READ type CONSTANT)
+	Q_PROPERTY(QString message READ message CONSTANT)
+	Q_PROPERTY(QString breaker READ breaker CONSTANT)
+
+protected:
+	QString _breaker;
+
+public:
+	static int type();
+
+	CircuitOpenError();
+	CircuitOpenError(const QString& msg, const QString& breaker);
+
+	QString breaker() const;
+};
+
 }} // quickstreams::exception
 
 namespace quickstreams {
 
+// The error is a value type either referencing an exception object
+// or describing the exception compactly by its type, message and code.
+// Compact errors are cheap to create and to pass around, their exception
+// object is only created when it's accessed through as or the -> operator.
+// Compact errors can only describe the built-in exception types
+// and the custom types registered along with their factory
 class Error {
 	friend class Executable;
 
@@ -327,15 +373,47 @@ class Error {
 	Q_PROPERTY(int type READ type CONSTANT)
 	Q_PROPERTY(QString name READ name CONSTANT)
 	Q_PROPERTY(QString message READ message CONSTANT)
+	Q_PROPERTY(qint64 code READ code CONSTANT)
 
 public:
 	typedef QSharedPointer<exception::Exception> Reference;
 
+	// Creates the exception object of a custom exception type
+	// described by the message and the code of a compact error
+	typedef std::function<exception::Exception* (
+		const QString& message,
+		qint64 code
+	)> Factory;
+
 private:
+	int _type;
+	qint64 _code;
+	QString _message;
+
+	// The breaker name of circuit open errors
+	QString _detail;
 	Reference _obj;
 
+	// Creates the exception object described by a compact error
+	// unless it already exists
+	void materialize();
+
 public:
 	Error(exception::Exception* instance = nullptr);
+
+	// Creates a compact error of the given exception type.
+	// The code is the error code of future, regex and system errors
+	// and the duration of timeout errors. Codes of system errors
+	// are restored in the system category. The detail is the breaker name
+	// of circuit open errors. Throws a logic error if the type
+	// is neither built-in nor registered
+	explicit Error(
+		int type,
+		const QString& message = QString(),
+		qint64 code = 0,
+		const QString& detail = QString()
+	);
+
 	bool isNull() const;
 	const exception::Exception* operator->();
 	int type() const;
@@ -344,16 +422,38 @@ public:
 	Q_INVOKABLE bool is(const QJSValue& type) const;
 	QString name() const;
 	QString message() const;
+	qint64 code() const;
 
+	// Returns the exception object if it's of type T, otherwise null
 	template <typename T>
 	T* as() {
-		// If the error doesn't reference any exception - create a default one
-		// to avoid occasional read access violations during runtime
-		if(_obj.isNull()) _obj = Reference(
-			new exception::Exception(), &exception::Exception::deleteLater
+		materialize();
+		return qobject_cast<T*>(_obj.data());
+	}
+
+	// Registers the factory of a custom exception type
+	static void registerType(int type, const Factory& factory);
+
+	// Registers the custom exception class T derived from
+	// exception::Exception and constructible from a message.
+	// Returns the type of the class
+	template <typename T>
+	static int registerType() {
+		static_assert(
+			std::is_base_of<exception::Exception, T>::value,
+			"QuickStreams - only classes derived from exception::Exception "
+			"can be registered as exception types"
 		);
-		return static_cast<T*>(_obj.data());
+		const int type(qRegisterMetaType<T*>());
+		registerType(type, [](const QString& message, qint64 code) {
+			Q_UNUSED(code)
+			return new T(message);
+		});
+		return type;
 	}
+
+	// Returns true if compact errors of the given type can be created
+	static bool isRegistered(int type);
 };
 
 }
@@ -379,4 +479,6 @@ Q_DECLARE_METATYPE(quickstreams::exception::OverflowError*)
 Q_DECLARE_METATYPE(quickstreams::exception::UnderflowError*)
 Q_DECLARE_METATYPE(quickstreams::exception::RegexError*)
 Q_DECLARE_METATYPE(quickstreams::exception::SystemError*)
+Q_DECLARE_METATYPE(quickstreams::exception::TimeoutError*)
+Q_DECLARE_METATYPE(quickstreams::exception::CircuitOpenError*)
 Q_DECLARE_METATYPE(quickstreams::Error)
@@ -0,0 +1,138 @@
+#include "ErrorMatcher.hpp"
+#include "Error.hpp"
+#include <QVariant>
+#include <QVector>
+#include <QMetaType>
+
+// The bits and ancestry masks of all exception types indexed
+// by their type relative to the lowest type
+struct ErrorHierarchy {
+	int base;
+	QVector<quint32> bits;
+	QVector<quint32> masks;
+
+	ErrorHierarchy();
+};
+
+ErrorHierarchy::ErrorHierarchy() :
+	base(0)
+{
+	using namespace quickstreams::exception;
+
+	// Each type is listed after its parent referenced by its index
+	struct Node {
+		int type;
+		int parent;
+	};
+	const Node nodes[] = {
+		{Exception::type(), -1},
+		{JsException::type(), 0},
+		{BadTypeId::type(), 0},
+		{BadCast::type(), 0},
+		{BadWeakPtr::type(), 0},
+		{BadFunctionCall::type(), 0},
+		{BadAlloc::type(), 0},
+		{BadArrayNewLength::type(), 6},
+		{BadException::type(), 0},
+		{LogicError::type(), 0},
+		{InvalidArgument::type(), 9},
+		{DomainError::type(), 9},
+		{LengthError::type(), 9},
+		{OutOfRange::type(), 9},
+		{FutureError::type(), 9},
+		{RuntimeError::type(), 0},
+		{RangeError::type(), 15},
+		{OverflowError::type(), 15},
+		{UnderflowError::type(), 15},
+		{RegexError::type(), 15},
+		{SystemError::type(), 15},
+		{TimeoutError::type(), 15},
+		{CircuitOpenError::type(), 15},
+	};
+	const int count(int(sizeof(nodes) / sizeof(Node)));
+	static_assert(
+		sizeof(nodes) / sizeof(Node) <= sizeof(quint32) * 8,
+		"QuickStreams - too many exception types for the ancestry mask"
+	);
+
+	int lowest(nodes[0].type);
+	int highest(nodes[0].type);
+	for(int itr(1); itr < count; itr++) {
+		lowest = qMin(lowest, nodes[itr].type);
+		highest = qMax(highest, nodes[itr].type);
+	}
+	base = lowest;
+	bits = QVector<quint32>(highest - lowest + 1, 0);
+	masks = QVector<quint32>(highest - lowest + 1, 0);
+
+	QVector<quint32> ancestries(count, 0);
+	for(int itr(0); itr < count; itr++) {
+		ancestries[itr] = quint32(1) << itr;
+		if(nodes[itr].parent >= 0) {
+			ancestries[itr] |= ancestries[nodes[itr].parent];
+		}
+		bits[nodes[itr].type - base] = quint32(1) << itr;
+		masks[nodes[itr].type - base] = ancestries[itr];
+	}
+}
+
+static const ErrorHierarchy& errorHierarchy() {
+	static const ErrorHierarchy instance;
+	return instance;
+}
+
+// Returns the index of the type in the tables of the hierarchy
+// or -1 if it's not a type of the exception namespace
+static int errorHierarchyIndex(const ErrorHierarchy& hierarchy, int type) {
+	const quint32 index(quint32(type - hierarchy.base));
+	if(index >= quint32(hierarchy.masks.size())) return -1;
+	if(hierarchy.bits.at(int(index)) == 0) return -1;
+	return int(index);
+}
+
+quickstreams::ErrorMatcher::ErrorMatcher() :
+	_mask(0)
+{}
+
+quickstreams::ErrorMatcher::ErrorMatcher(const TypeList& types) :
+	_mask(0)
+{
+	for(
+		TypeList::const_iterator itr(types.constBegin());
+		itr != types.constEnd();
+		itr++
+	) add(*itr);
+}
+
+void quickstreams::ErrorMatcher::add(int type) {
+	const ErrorHierarchy& hierarchy(errorHierarchy());
+	const int index(errorHierarchyIndex(hierarchy, type));
+	if(index < 0) _others.insert(type);
+	else _mask |= hierarchy.bits.at(index);
+}
+
+quint32 quickstreams::ErrorMatcher::ancestry(int type) {
+	const ErrorHierarchy& hierarchy(errorHierarchy());
+	const int index(errorHierarchyIndex(hierarchy, type));
+	if(index < 0) return 0;
+	return hierarchy.masks.at(index);
+}
+
+bool quickstreams::ErrorMatcher::matches(int type) const {
+	if(ancestry(type) & _mask) return true;
+	return !_others.isEmpty() && _others.contains(type);
+}
+
+bool quickstreams::ErrorMatcher::matches(const Error& error) const {
+	return matches(error.type());
+}
+
+bool quickstreams::ErrorMatcher::matches(const QVariant& error) const {
+	// Inspect the error in place instead of copying it out of the variant
+	if(error.userType() != qMetaTypeId<Error>()) return false;
+	return matches(static_cast<const Error*>(error.constData())->type());
+}
+
+bool quickstreams::ErrorMatcher::isEmpty() const {
+	return _mask == 0 && _others.isEmpty();
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Error.hpp"
+#include <QVariant>
+#include <QVector>
+#include <QSet>
+
+namespace quickstreams {
+
+// The error matcher matches errors by their type honoring the inheritance
+// of the exception types, an error matches if its type or any of
+// its ancestors is among the matched types. Each exception type
+// of the exception namespace is assigned a bit, the matched types
+// are precomputed into a mask and the ancestry of each exception type
+// into a table of masks, thus matching them is a single mask test.
+// Other types, such as the types of translated custom exceptions,
+// are matched by their exact type.
+class ErrorMatcher {
+public:
+	typedef QVector<int> TypeList;
+	typedef QSet<int> Types;
+
+protected:
+	quint32 _mask;
+	Types _others;
+
+public:
+	ErrorMatcher();
+	ErrorMatcher(const TypeList& types);
+
+	// Adds the type to the matched types
+	void add(int type);
+
+	// Returns the mask of the exception type and all of its ancestors
+	// or 0 if it's not a type of the exception namespace
+	static quint32 ancestry(int type);
+
+	bool matches(int type) const;
+	bool matches(const Error& error) const;
+
+	// Returns false if the variant doesn't hold an error
+	bool matches(const QVariant& error) const;
+
+	bool isEmpty() const;
+};
+
+} // quickstreams
@@ -0,0 +1,164 @@
+#include "ExceptionTranslator.hpp"
+#include "Error.hpp"
+#include <exception>
+#include <future>
+#include <regex>
+#include <string>
+#include <system_error>
+#include <QString>
+#include <QReadLocker>
+#include <QWriteLocker>
+
+quickstreams::ExceptionTranslator::ExceptionTranslator() {
+	// Base types are added first for their descendants to take precedence
+	add<std::exception>(exception::Exception::type());
+	add<std::logic_error>(exception::LogicError::type());
+	add<std::invalid_argument>(exception::InvalidArgument::type());
+	add<std::domain_error>(exception::DomainError::type());
+	add<std::length_error>(exception::LengthError::type());
+	add<std::out_of_range>(exception::OutOfRange::type());
+	add<std::future_error>([](const std::future_error& error) {
+		return Error(
+			exception::FutureError::type(), QString(), error.code().value()
+		);
+	});
+	add<std::runtime_error>(exception::RuntimeError::type());
+	add<std::range_error>(exception::RangeError::type());
+	add<std::overflow_error>(exception::OverflowError::type());
+	add<std::underflow_error>(exception::UnderflowError::type());
+	add<std::regex_error>([](const std::regex_error& error) {
+		return Error(exception::RegexError::type(), QString(), error.code());
+	});
+	add<std::system_error>([](const std::system_error& error) {
+		// Only codes of the system category are restored from their value,
+		// errors of other categories keep the original error code
+		if(error.code().category() != std::system_category()) {
+			return Error(
+				new exception::SystemError(error.what(), error.code())
+			);
+		}
+		return Error(
+			exception::SystemError::type(), error.what(), error.code().value()
+		);
+	});
+	add<std::bad_typeid>(exception::BadTypeId::type());
+	add<std::bad_cast>(exception::BadCast::type());
+	add<std::bad_weak_ptr>(exception::BadWeakPtr::type());
+	add<std::bad_function_call>(exception::BadFunctionCall::type());
+	add<std::bad_alloc>(exception::BadAlloc::type());
+	add<std::bad_array_new_length>(exception::BadArrayNewLength::type());
+	add<std::bad_exception>(exception::BadException::type());
+
+	// Messages thrown directly
+	add<const char*>([](const char* const& error) {
+		return Error(exception::Exception::type(), error);
+	});
+	add<std::string>([](const std::string& error) {
+		return Error(
+			exception::Exception::type(), QString::fromStdString(error)
+		);
+	});
+	add<QString>([](const QString& error) {
+		return Error(exception::Exception::type(), error);
+	});
+}
+
+void quickstreams::ExceptionTranslator::addStandard(
+	const StandardTranslation& translation
+) {
+	QWriteLocker lock(&_lock);
+	_standard.append(translation);
+
+	// The new translation may take precedence over resolved ones
+	_resolved.clear();
+}
+
+void quickstreams::ExceptionTranslator::addOther(
+	const OtherTranslation& translation
+) {
+	QWriteLocker lock(&_lock);
+	_other.append(translation);
+}
+
+int quickstreams::ExceptionTranslator::resolve(
+	const StandardTranslations& standard,
+	const std::exception& exception
+) {
+	// Replace the resolved translation only by one of a more derived type
+	// so the most recently added one wins among translations of the same type
+	int resolved(-1);
+	for(int index(standard.size() - 1); index >= 0; index--) {
+		const StandardTranslation& translation(standard.at(index));
+		if(!translation.matches(exception)) continue;
+		if(resolved < 0) {
+			resolved = index;
+			continue;
+		}
+		const StandardTranslation& current(standard.at(resolved));
+		if(
+			current.derives(translation.throwPointer)
+			&& !translation.derives(current.throwPointer)
+		) resolved = index;
+	}
+	return resolved;
+}
+
+quickstreams::Error quickstreams::ExceptionTranslator::translateStandard(
+	const std::exception& exception
+) const {
+	// The translations are copied to execute them without holding the lock,
+	// the copy is cheap since the vector is implicitly shared
+	const std::type_index type(typeid(exception));
+	StandardTranslations standard;
+	int index(-1);
+	bool resolved(false);
+	{
+		QReadLocker lock(&_lock);
+		ResolvedTranslations::const_iterator itr(_resolved.find(type));
+		if(itr != _resolved.end()) {
+			standard = _standard;
+			index = itr->second;
+			resolved = true;
+		}
+	}
+
+	// Resolve the translation of the type once
+	if(!resolved) {
+		QWriteLocker lock(&_lock);
+		standard = _standard;
+		index = resolve(standard, exception);
+		_resolved[type] = index;
+	}
+
+	if(index < 0) return Error(exception::Exception::type(), exception.what());
+	return standard.at(index).translate(exception);
+}
+
+quickstreams::Error quickstreams::ExceptionTranslator::translateOther(
+	const std::exception_ptr& exception
+) const {
+	OtherTranslations other;
+	{
+		QReadLocker lock(&_lock);
+		other = _other;
+	}
+	Error error;
+	for(int index(other.size() - 1); index >= 0; index--) {
+		if(other.at(index)(exception, error)) return error;
+	}
+	return Error(exception::Exception::type(), "Unkown error");
+}
+
+quickstreams::Error quickstreams::ExceptionTranslator::translate(
+	const std::exception_ptr& exception
+) const {
+	try {
+		std::rethrow_exception(exception);
+	} catch(const Error& error) {
+		return error;
+	} catch(const std::exception& error) {
+		return translateStandard(error);
+	} catch(...) {
+		return translateOther(exception);
+	}
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "Error.hpp"
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <typeindex>
+#include <typeinfo>
+#include <type_traits>
+#include <unordered_map>
+#include <QVector>
+#include <QReadWriteLock>
+
+namespace quickstreams {
+
+// The exception translator translates exceptions thrown by the functions
+// of C++ executables into errors. It translates all standard exceptions
+// to their exception type replicas by default and can be extended
+// by translations of custom exception types, for instance to let
+// custom errors drive retries by their type.
+//
+// Exceptions derived from std::exception are dispatched by their dynamic
+// type. The translation of an exception type is resolved once,
+// the translation of the most derived matching type wins and among
+// translations of the same type the most recently added one wins.
+// Other exceptions are translated by the most recently added translation
+// catching them. Translations may be added from any thread
+// and are executed without holding the lock of the translator.
+class ExceptionTranslator {
+public:
+	template<typename T>
+	using Translation = std::function<Error (const T&)>;
+
+protected:
+	struct StandardTranslation {
+		std::function<bool (const std::exception&)> matches;
+		Translation<std::exception> translate;
+
+		// Throws a null pointer to the translated type, it's caught
+		// by the derives check of the translations of its ancestors
+		std::function<void ()> throwPointer;
+		std::function<bool (const std::function<void ()>&)> derives;
+	};
+	typedef QVector<StandardTranslation> StandardTranslations;
+
+	// Rethrows the exception and translates it if it's caught,
+	// returns false if the exception isn't of the translated type
+	typedef std::function<bool (const std::exception_ptr&, Error&)>
+		OtherTranslation;
+	typedef QVector<OtherTranslation> OtherTranslations;
+
+	// Maps dynamic exception types to the index of their translation
+	// or to -1 if there's none
+	typedef std::unordered_map<std::type_index, int> ResolvedTranslations;
+
+	StandardTranslations _standard;
+	OtherTranslations _other;
+	mutable ResolvedTranslations _resolved;
+	mutable QReadWriteLock _lock;
+
+	void addStandard(const StandardTranslation& translation);
+	void addOther(const OtherTranslation& translation);
+	Error translateStandard(const std::exception& exception) const;
+
+	// Returns the index of the translation of the most derived type
+	// matching the exception or -1 if there's none
+	static int resolve(
+		const StandardTranslations& standard,
+		const std::exception& exception
+	);
+	Error translateOther(const std::exception_ptr& exception) const;
+
+	template<typename T>
+	void addTranslation(Translation<T> translation, std::true_type) {
+		addStandard(StandardTranslation{
+			[](const std::exception& exception) {
+				return dynamic_cast<const T*>(&exception) != nullptr;
+			},
+			[translation](const std::exception& exception) {
+				return translation(*dynamic_cast<const T*>(&exception));
+			},
+			[]() {
+				throw static_cast<T*>(nullptr);
+			},
+			[](const std::function<void ()>& throwPointer) {
+				// Pointers to derived types are caught as pointers to T
+				try {
+					throwPointer();
+				} catch(T*) {
+					return true;
+				} catch(...) {
+					return false;
+				}
+				return false;
+			}
+		});
+	}
+
+	template<typename T>
+	void addTranslation(Translation<T> translation, std::false_type) {
+		addOther([translation](
+			const std::exception_ptr& exception, Error& error
+		) {
+			try {
+				std::rethrow_exception(exception);
+			} catch(const T& caught) {
+				error = translation(caught);
+				return true;
+			} catch(...) {
+				return false;
+			}
+		});
+	}
+
+public:
+	// Creates a translator translating all standard exceptions
+	ExceptionTranslator();
+
+	ExceptionTranslator(const ExceptionTranslator&) = delete;
+	ExceptionTranslator& operator=(const ExceptionTranslator&) = delete;
+
+	// Adds the translation of exceptions of type T
+	template<typename T>
+	void add(Translation<T> translation) {
+		addTranslation<T>(
+			translation,
+			typename std::is_base_of<std::exception, T>::type()
+		);
+	}
+
+	// Translates exceptions of type T into compact errors
+	// of the given type carrying the message of the exception.
+	// Throws a logic error if the type is neither built-in nor registered
+	template<typename T>
+	void add(int type) {
+		static_assert(
+			std::is_base_of<std::exception, T>::value,
+			"QuickStreams - only exceptions derived from std::exception "
+			"can be translated by type"
+		);
+		if(!Error::isRegistered(type)) throw std::logic_error(
+			"QuickStreams - FATAL ERROR: "
+			"translation into an unregistered exception type"
+		);
+		add<T>([type](const T& exception) {
+			return Error(type, exception.what());
+		});
+	}
+
+	// Translates exceptions of type T into compact errors of the custom
+	// exception class E carrying the message of the exception,
+	// E is registered as exception type
+	template<typename T, typename E>
+	void add() {
+		add<T>(Error::registerType<E>());
+	}
+
+	// Translates the given exception
+	Error translate(const std::exception_ptr& exception) const;
+};
+
+} // quickstreams
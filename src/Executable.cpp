@@ -1,24 +1,41 @@
 #include "Executable.hpp"
 #include "StreamHandle.hpp"
 #include "Error.hpp"
+#include "ExceptionTranslator.hpp"
+#include <exception>
 #include <QVariant>
 
 quickstreams::Executable::Executable() :
 	_handle(nullptr),
-	_returnedStream(nullptr)
+	_returnedStream(nullptr),
+	_translator(nullptr)
 {}
 
 void quickstreams::Executable::setHandle(StreamHandle* handle) {
 	_handle = handle;
 }
 
+void quickstreams::Executable::setTranslator(
+	const ExceptionTranslator* translator
+) {
+	_translator = translator;
+}
+
+quickstreams::Error quickstreams::Executable::translateException() const {
+	// Executables not executed by a stream translate standard exceptions only
+	static const ExceptionTranslator standard;
+	const ExceptionTranslator* translator(_translator);
+	if(translator == nullptr) translator = &standard;
+	return translator->translate(std::current_exception());
+}
+
 void quickstreams::Executable::reset() {
-	_error._obj.reset();
+	_error = Error();
 	_returnedStream = nullptr;
 }
 
 bool quickstreams::Executable::hasFailed() const {
-	return !_error._obj.isNull();
+	return !_error.isNull();
 }
 
 bool quickstreams::Executable::hasReturnedStream() const {
@@ -2,6 +2,7 @@
 
 #include "StreamHandle.hpp"
 #include "Error.hpp"
+#include "ExceptionTranslator.hpp"
 #include <QVariant>
 #include <QSharedPointer>
 
@@ -19,8 +20,14 @@ protected:
 	StreamHandle* _handle;
 	Error _error;
 	Stream* _returnedStream;
+	const ExceptionTranslator* _translator;
 
 	void setHandle(StreamHandle* handle);
+	void setTranslator(const ExceptionTranslator* translator);
+
+	// Translates the exception currently being handled into an error,
+	// must only be called in a catch block
+	Error translateException() const;
 
 public:
 	virtual ~Executable() {}
@@ -0,0 +1,187 @@
+#include "HedgeExecutable.hpp"
+#include "Stream.hpp"
+#include "Error.hpp"
+#include <QObject>
+#include <QVariant>
+#include <QString>
+
+quickstreams::HedgeExecutable::HedgeExecutable(
+	Factory factory,
+	const HedgePolicy::Reference& policy,
+	int maxAttempts,
+	TimerWheel* timers
+) :
+	_factory(factory),
+	_policy(policy),
+	_timers(timers),
+	_maxAttempts(maxAttempts < 1 ? 1 : maxAttempts)
+{
+	if(_policy.isNull()) _policy.reset(new HedgePolicy());
+}
+
+void quickstreams::HedgeExecutable::launchAttempt(
+	const HedgingReference& hedging
+) {
+	// Don't launch any new attempts once the hedge stream is aborted
+	if(hedging->settled || hedging->handle.isAborted()) return;
+	if(hedging->attempts.size() >= hedging->maxAttempts) return;
+
+	auto stream(hedging->factory(hedging->data));
+
+	// A null stream passes the data through unchanged
+	if(stream.isNull()) {
+		settle(hedging, -1);
+		hedging->handle.close(hedging->data);
+		return;
+	}
+
+	// The attempt is launched by the hedge
+	// instead of being launched on its own
+	stream->verifyCombinable();
+	stream->_captionStatus = Stream::CaptionStatus::Bound;
+	hedging->handle.adopt(stream);
+
+	const int index(hedging->attempts.size());
+	hedging->attempts.append(stream.toWeakRef());
+	hedging->launchedAt.append(hedging->clock.elapsed());
+	++hedging->pending;
+
+	auto attempt(stream.data());
+	QObject::connect(
+		attempt, &Stream::closed,
+		attempt, [hedging, index](
+			QVariant data, Stream::WakeCondition wakeCondition
+		) {
+			// Aborted attempts never win the hedge
+			if(
+				wakeCondition == Stream::WakeCondition::Abort
+				|| wakeCondition == Stream::WakeCondition::AbortNoDelay
+			) {
+				onAborted(hedging, index, data);
+				return;
+			}
+			onClosed(hedging, index, data);
+		}
+	);
+	QObject::connect(
+		attempt, &Stream::failed,
+		attempt, [hedging](
+			QVariant error, Stream::WakeCondition wakeCondition
+		) {
+			Q_UNUSED(wakeCondition)
+			onFailed(hedging, error);
+		}
+	);
+	QObject::connect(
+		attempt, &Stream::aborted,
+		attempt, [hedging, index](
+			QVariant reason, Stream::WakeCondition wakeCondition
+		) {
+			Q_UNUSED(wakeCondition)
+			onAborted(hedging, index, reason);
+		}
+	);
+
+	stream->launch(hedging->data);
+
+	// Hedge the attempt unless it already settled
+	if(hedging->settled) return;
+	if(hedging->attempts.size() < hedging->maxAttempts) {
+		hedging->timers->schedule(
+			&hedging->timer,
+			hedging->policy->threshold()
+		);
+	}
+}
+
+void quickstreams::HedgeExecutable::onClosed(
+	const HedgingReference& hedging,
+	int index,
+	const QVariant& data
+) {
+	if(hedging->settled) return;
+	settle(hedging, index);
+
+	// Only the latencies of regularly settled calls are tracked
+	if(!hedging->handle.isAborted()) {
+		hedging->policy->record(qint32(
+			hedging->clock.elapsed() - hedging->launchedAt.at(index)
+		));
+	}
+	hedging->handle.close(data);
+}
+
+void quickstreams::HedgeExecutable::onFailed(
+	const HedgingReference& hedging,
+	const QVariant& error
+) {
+	if(hedging->settled) return;
+	--hedging->pending;
+
+	// Launch the next attempt right away instead of waiting
+	// for the threshold and only fail if there's no attempt left
+	hedging->timer.cancel();
+	launchAttempt(hedging);
+	if(hedging->settled || hedging->pending > 0) return;
+
+	settle(hedging, -1);
+	hedging->handle.fail(error);
+}
+
+void quickstreams::HedgeExecutable::onAborted(
+	const HedgingReference& hedging,
+	int index,
+	const QVariant& reason
+) {
+	if(hedging->settled) return;
+	if(!hedging->handle.isAborted()) {
+		onFailed(hedging, QVariant::fromValue<Error>(Error(
+			exception::Exception::type(),
+			QString("hedged attempt %1 was aborted").arg(index)
+		)));
+		return;
+	}
+
+	// Closing the aborted hedge stream awakes its abortion sequence
+	if(--hedging->pending > 0) return;
+	settle(hedging, -1);
+	hedging->handle.close(reason);
+}
+
+void quickstreams::HedgeExecutable::settle(
+	const HedgingReference& hedging,
+	int winner
+) {
+	hedging->settled = true;
+	hedging->timer.cancel();
+
+	// Abort the losers
+	for(int itr(0); itr < hedging->attempts.size(); ++itr) {
+		if(itr == winner) continue;
+		auto attempt(hedging->attempts.at(itr).toStrongRef());
+		if(!attempt.isNull()) attempt->abort();
+	}
+}
+
+void quickstreams::HedgeExecutable::execute(const QVariant& data) {
+	HedgingReference hedging(new Hedging());
+	hedging->handle = *_handle;
+	hedging->factory = _factory;
+	hedging->policy = _policy;
+	hedging->timers = _timers;
+	hedging->data = data;
+	hedging->maxAttempts = _maxAttempts;
+	hedging->pending = 0;
+	hedging->settled = false;
+	hedging->clock.start();
+
+	// The timer must not keep the hedging alive, it's canceled
+	// as soon as the hedging is destroyed
+	QWeakPointer<Hedging> weak(hedging.toWeakRef());
+	hedging->timer.setCallback([weak]() {
+		auto hedging(weak.toStrongRef());
+		if(!hedging.isNull()) launchAttempt(hedging);
+	});
+
+	launchAttempt(hedging);
+}
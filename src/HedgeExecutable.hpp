@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Executable.hpp"
+#include "StreamHandle.hpp"
+#include "Stream.hpp"
+#include "HedgePolicy.hpp"
+#include "TimerWheel.hpp"
+#include <functional>
+#include <QVector>
+#include <QVariant>
+#include <QElapsedTimer>
+#include <QSharedPointer>
+#include <QWeakPointer>
+
+namespace quickstreams {
+
+class Provider;
+
+// The hedge executable launches an attempt created by a factory
+// and launches a duplicate attempt whenever the previous one didn't settle
+// within the threshold of the hedge policy. The first attempt to close wins
+// and the remaining attempts are aborted. Attempts are adopted
+// by the stream the executable belongs to.
+class HedgeExecutable : public Executable {
+	friend class Provider;
+
+public:
+	// Returns a new free stream performing the attempt
+	typedef std::function<Stream::Reference(const QVariant& data)> Factory;
+
+protected:
+	// The hedging outlives the executable for the observers
+	// of the attempts to remain safe even if the hedge stream died
+	struct Hedging {
+		StreamHandle handle;
+		Factory factory;
+		HedgePolicy::Reference policy;
+		TimerWheel* timers;
+		TimerWheel::Timer timer;
+		QVariant data;
+		QVector<QWeakPointer<Stream>> attempts;
+		QVector<qint64> launchedAt;
+		QElapsedTimer clock;
+		int maxAttempts;
+		int pending;
+		bool settled;
+	};
+	typedef QSharedPointer<Hedging> HedgingReference;
+
+	Factory _factory;
+	HedgePolicy::Reference _policy;
+	TimerWheel* _timers;
+	int _maxAttempts;
+
+	HedgeExecutable(
+		Factory factory,
+		const HedgePolicy::Reference& policy,
+		int maxAttempts,
+		TimerWheel* timers
+	);
+
+	// Launches the next attempt if the hedging is neither settled
+	// nor aborted and the maximum number of attempts isn't reached yet
+	static void launchAttempt(const HedgingReference& hedging);
+
+	static void onClosed(
+		const HedgingReference& hedging,
+		int index,
+		const QVariant& data
+	);
+	static void onFailed(
+		const HedgingReference& hedging,
+		const QVariant& error
+	);
+
+	// Attempts of an aborted hedge settle it into its abortion sequence
+	// once all of them settled, attempts aborted from outside
+	// can never close and are considered failed
+	static void onAborted(
+		const HedgingReference& hedging,
+		int index,
+		const QVariant& reason
+	);
+
+	// Marks the hedging as settled and aborts all attempts
+	// except the given winner
+	static void settle(const HedgingReference& hedging, int winner);
+
+public:
+	void execute(const QVariant& data);
+};
+
+} // quickstreams
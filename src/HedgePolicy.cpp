@@ -0,0 +1,40 @@
+#include "HedgePolicy.hpp"
+#include <algorithm>
+#include <cmath>
+#include <QVector>
+
+quickstreams::HedgePolicy::HedgePolicy(
+	double percentile,
+	qint32 initialDelay,
+	int windowSize,
+	int minimumSamples
+) :
+	_percentile(qBound(0.0, percentile, 1.0)),
+	_initialDelay(initialDelay < 0 ? 0 : initialDelay),
+	_minimumSamples(minimumSamples < 1 ? 1 : minimumSamples),
+	_samples(windowSize < 1 ? 1 : windowSize, 0),
+	_next(0),
+	_count(0)
+{}
+
+void quickstreams::HedgePolicy::record(qint32 latency) {
+	_samples[_next] = latency < 0 ? 0 : latency;
+	_next = (_next + 1) % _samples.size();
+	if(_count < _samples.size()) _count++;
+}
+
+qint32 quickstreams::HedgePolicy::threshold() const {
+	if(_count < _minimumSamples) return _initialDelay;
+
+	// Select the percentile from a copy of the window
+	QVector<qint32> samples(_samples);
+	auto end(samples.begin() + _count);
+	int rank(int(std::ceil(_percentile * _count)) - 1);
+	if(rank < 0) rank = 0;
+	std::nth_element(samples.begin(), samples.begin() + rank, end);
+	return samples.at(rank);
+}
+
+int quickstreams::HedgePolicy::samples() const {
+	return _count;
+}
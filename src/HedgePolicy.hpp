@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QVector>
+#include <QSharedPointer>
+
+namespace quickstreams {
+
+// The hedge policy tracks the latencies of recent hedged calls
+// in a sliding window and derives the hedging threshold from the given
+// percentile of them. A policy is usually shared by all hedged calls
+// of the same operation. It must only be used on the provider thread.
+class HedgePolicy {
+public:
+	typedef QSharedPointer<HedgePolicy> Reference;
+
+protected:
+	double _percentile;
+	qint32 _initialDelay;
+	int _minimumSamples;
+
+	// Ring buffer of the most recent latencies in milliseconds
+	QVector<qint32> _samples;
+	int _next;
+	int _count;
+
+public:
+	// The initial delay is used as the threshold
+	// until the minimum number of samples is recorded
+	HedgePolicy(
+		double percentile = 0.95,
+		qint32 initialDelay = 100,
+		int windowSize = 100,
+		int minimumSamples = 10
+	);
+
+	// Records the latency of a settled call
+	void record(qint32 latency);
+
+	// Returns the number of milliseconds after which a call is hedged
+	qint32 threshold() const;
+
+	// Returns the number of latencies within the window
+	int samples() const;
+};
+
+} // quickstreams
@@ -1,4 +1,5 @@
 #include "JsCallback.hpp"
+#include "JsMarshalling.hpp"
 #include <QJSValue>
 #include <QVariant>
 #include <QQmlEngine>
@@ -13,6 +14,6 @@ quickstreams::JsCallback::JsCallback(
 
 void quickstreams::JsCallback::execute(const QVariant& data) {
 	_function.call({
-		_engine->toScriptValue(data)
+		qml::JsMarshalling::toScriptValue(_engine, data)
 	});
 }
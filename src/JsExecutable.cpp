@@ -3,6 +3,7 @@
 #include "QmlStream.hpp"
 #include "QmlStreamHandle.hpp"
 #include "Error.hpp"
+#include "JsMarshalling.hpp"
 #include <QQmlEngine>
 #include <QJSValue>
 #include <QVariant>
@@ -16,29 +17,27 @@ quickstreams::qml::JsExecutable::JsExecutable(
 {}
 
 void quickstreams::qml::JsExecutable::execute(const QVariant& data) {
+	if(_scriptHandle.isUndefined() || _qmlHandle._handle != *_handle) {
+		_qmlHandle._handle = *_handle;
+		_scriptHandle = _engine->toScriptValue(_qmlHandle);
+	}
+
 	// Execute
-	QJSValue result(_function.call({
-		_engine->toScriptValue(_qmlHandle),
-		_engine->toScriptValue(data),
-	}));
-	auto var(result.toVariant());
+	auto result(JsMarshalling::classify(_engine, _function.call({
+		_scriptHandle,
+		JsMarshalling::toScriptValue(_engine, data),
+	})));
 
 	// Evaluate execution results. If a stream was returned then wrap it;
 	// If error was returned then remember the error for later handling.
-	if(var.canConvert<quickstreams::qml::QmlStream*>()) {
-		_returnedStream = qjsvalue_cast<quickstreams::qml::QmlStream*>(
-			result
-		)->_reference.data();
-	} else if(result.isError()) {
-		auto exception(new quickstreams::exception::JsException(
-			result.property("name").toString(),
-			result.property("message").toString(),
-			QVariant()
-		));
-		_engine->setObjectOwnership(exception, QQmlEngine::CppOwnership);
-		_error = Error(qobject_cast<exception::JsException*>(exception));
-	} else if(var.canConvert<exception::Exception*>()) {
-		auto exception(var.value<exception::Exception*>());
-		_error = Error(exception);
+	switch(result.kind) {
+	case JsMarshalling::Result::Kind::Stream:
+		_returnedStream = result.stream->_reference.data();
+		break;
+	case JsMarshalling::Result::Kind::Error:
+		_error = result.error;
+		break;
+	default:
+		break;
 	}
 }
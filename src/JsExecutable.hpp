@@ -22,6 +22,11 @@ protected:
 	QmlStreamHandle _qmlHandle;
 	QJSValue _function;
 
+	// The handle is wrapped into a JavaScript value only once
+	// when the executable is first executed and again
+	// whenever a retrial or repetition renewed the handle
+	QJSValue _scriptHandle;
+
 	JsExecutable(
 		QQmlEngine* engine,
 		const QJSValue& function
@@ -0,0 +1,58 @@
+#include "JsMarshalling.hpp"
+#include "QmlStream.hpp"
+#include "Error.hpp"
+#include <QQmlEngine>
+#include <QJSValue>
+#include <QVariant>
+#include <QMetaType>
+#include <QObject>
+
+QJSValue quickstreams::qml::JsMarshalling::toScriptValue(
+	QQmlEngine* engine,
+	const QVariant& data
+) {
+	switch(data.userType()) {
+	case QMetaType::UnknownType: return QJSValue();
+	case QMetaType::Bool: return QJSValue(data.toBool());
+	case QMetaType::Int: return QJSValue(data.toInt());
+	case QMetaType::UInt: return QJSValue(data.toUInt());
+	case QMetaType::Double: return QJSValue(data.toDouble());
+	case QMetaType::Float: return QJSValue(data.toDouble());
+	case QMetaType::QString: return QJSValue(data.toString());
+	default: return engine->toScriptValue(data);
+	}
+}
+
+quickstreams::qml::JsMarshalling::Result
+quickstreams::qml::JsMarshalling::classify(
+	QQmlEngine* engine,
+	const QJSValue& result
+) {
+	Result classified{Result::Kind::Value, nullptr, quickstreams::Error()};
+
+	// Streams and exception objects are the only objects with a meaning,
+	// inspect them without converting the result to a variant
+	if(result.isQObject()) {
+		QObject* object(result.toQObject());
+		if(auto stream = qobject_cast<QmlStream*>(object)) {
+			classified.kind = Result::Kind::Stream;
+			classified.stream = stream;
+		} else if(
+			auto exception = qobject_cast<exception::Exception*>(object)
+		) {
+			engine->setObjectOwnership(exception, QQmlEngine::CppOwnership);
+			classified.kind = Result::Kind::Error;
+			classified.error = quickstreams::Error(exception);
+		}
+	} else if(result.isError()) {
+		auto exception(new exception::JsException(
+			result.property("name").toString(),
+			result.property("message").toString(),
+			QVariant()
+		));
+		engine->setObjectOwnership(exception, QQmlEngine::CppOwnership);
+		classified.kind = Result::Kind::Error;
+		classified.error = quickstreams::Error(exception);
+	}
+	return classified;
+}
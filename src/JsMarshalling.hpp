@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Error.hpp"
+#include <QQmlEngine>
+#include <QJSValue>
+#include <QVariant>
+
+namespace quickstreams {
+namespace qml {
+
+class QmlStream;
+
+// Converts the arguments and results of JavaScript functions called
+// by the JavaScript executables and callbacks
+class JsMarshalling {
+public:
+	// The result of a JavaScript function
+	struct Result {
+		enum class Kind : char {
+			// Any value of any type or null/undefined
+			Value,
+
+			// A stream to wait for
+			Stream,
+
+			// A JavaScript error or an exception object
+			Error
+		};
+
+		Kind kind;
+		QmlStream* stream;
+		quickstreams::Error error;
+	};
+
+	// Converts the data to a JavaScript value. Primitive values
+	// are converted directly without involving the engine
+	static QJSValue toScriptValue(QQmlEngine* engine, const QVariant& data);
+
+	// Classifies the result of a JavaScript function in a single pass.
+	// Exception objects are taken over by C++
+	static Result classify(QQmlEngine* engine, const QJSValue& result);
+};
+
+}} // quickstreams::qml
@@ -11,7 +11,7 @@ quickstreams::JsTypeRetryer::JsTypeRetryer(
 	Retryer(maxTrials)
 {
 	switch(errorTypes.userType()) {
-	case QMetaType::Int: _ids.insert(errorTypes.toInt()); break;
+	case QMetaType::Int: _matcher.add(errorTypes.toInt()); break;
 	case QMetaType::QString: _names.insert(errorTypes.toString()); break;
 	case QMetaType::QVariantList:
 		auto list(errorTypes.toList());
@@ -22,7 +22,7 @@ quickstreams::JsTypeRetryer::JsTypeRetryer(
 		) {
 			// Accept only integer and string identifiers, ignore other types
 			switch(itr->userType()) {
-			case QMetaType::Int: _ids.insert(itr->toInt()); break;
+			case QMetaType::Int: _matcher.add(itr->toInt()); break;
 			case QMetaType::QString: _names.insert(itr->toString()); break;
 			default: break;
 			}
@@ -36,7 +36,7 @@ bool quickstreams::JsTypeRetryer::verifyCondition(const QVariant& error) {
 	auto type(err.type());
 
 	// In case of typed errors check by integer metatype identifier
-	if(type != exception::JsException::type()) return _ids.contains(type);
+	if(type != exception::JsException::type()) return _matcher.matches(type);
 
 	// In case of JavaScript errors check by name
 	auto jsError(err.as<exception::JsException>());
@@ -2,6 +2,7 @@
 
 #include "Retryer.hpp"
 #include "JsTypeRetryer.hpp"
+#include "ErrorMatcher.hpp"
 #include <QVariant>
 #include <QString>
 #include <QSet>
@@ -10,11 +11,10 @@ namespace quickstreams {
 
 class JsTypeRetryer : public Retryer {
 public:
-	typedef QSet<int> Identifiers;
 	typedef QSet<QString> Names;
 
 protected:
-	Identifiers _ids;
+	ErrorMatcher _matcher;
 	Names _names;
 
 public:
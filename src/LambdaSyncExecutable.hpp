@@ -10,10 +10,12 @@ namespace quickstreams {
 
 class Provider;
 class Stream;
+class SequenceTemplate;
 
 class LambdaSyncExecutable : public Executable {
 	friend class Provider;
 	friend class Stream;
+	friend class SequenceTemplate;
 
 public:
 	typedef std::function<QVariant (const QVariant&)> Function;
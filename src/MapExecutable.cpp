@@ -0,0 +1,180 @@
+#include "MapExecutable.hpp"
+#include "Stream.hpp"
+#include "Error.hpp"
+#include <QObject>
+#include <QVariant>
+#include <QVariantList>
+#include <QString>
+
+quickstreams::MapExecutable::MapExecutable(
+	const QVariantList& items,
+	Factory factory,
+	int maxInFlight,
+	bool ordered
+) :
+	_items(items),
+	_factory(factory),
+	_maxInFlight(maxInFlight < 1 ? 1 : maxInFlight),
+	_ordered(ordered)
+{}
+
+void quickstreams::MapExecutable::launchNext(const MappingReference& mapping) {
+	++mapping->launches;
+	if(mapping->launching) return;
+	mapping->launching = true;
+	while(mapping->launches > 0) {
+		--mapping->launches;
+		launch(mapping);
+	}
+	mapping->launching = false;
+}
+
+void quickstreams::MapExecutable::launch(const MappingReference& mapping) {
+	// Don't launch any new streams once the map stream is aborted
+	if(mapping->settled || mapping->handle.isAborted()) return;
+	if(mapping->next >= mapping->items.size()) return;
+
+	const int index(mapping->next++);
+	const QVariant item(mapping->items.at(index));
+	auto stream(mapping->factory(item));
+
+	// A null stream passes the item through unchanged
+	if(stream.isNull()) {
+		++mapping->inFlight;
+		onClosed(mapping, index, item);
+		return;
+	}
+
+	// The created stream is launched by the map
+	// instead of being launched on its own
+	stream->verifyCombinable();
+	stream->_captionStatus = Stream::CaptionStatus::Bound;
+	mapping->handle.adopt(stream);
+
+	auto member(stream.data());
+	QObject::connect(
+		member, &Stream::closed,
+		member, [mapping, index](
+			QVariant data, Stream::WakeCondition wakeCondition
+		) {
+			// Aborted streams never close successfully
+			if(
+				wakeCondition == Stream::WakeCondition::Abort
+				|| wakeCondition == Stream::WakeCondition::AbortNoDelay
+			) {
+				onAborted(mapping, index, data);
+				return;
+			}
+			onClosed(mapping, index, data);
+		}
+	);
+	QObject::connect(
+		member, &Stream::failed,
+		member, [mapping](
+			QVariant error, Stream::WakeCondition wakeCondition
+		) {
+			Q_UNUSED(wakeCondition)
+			onFailed(mapping, error);
+		}
+	);
+	QObject::connect(
+		member, &Stream::aborted,
+		member, [mapping, index](
+			QVariant reason, Stream::WakeCondition wakeCondition
+		) {
+			Q_UNUSED(wakeCondition)
+			onAborted(mapping, index, reason);
+		}
+	);
+
+	++mapping->inFlight;
+	stream->launch(item);
+}
+
+void quickstreams::MapExecutable::onClosed(
+	const MappingReference& mapping,
+	int index,
+	const QVariant& data
+) {
+	if(mapping->settled) return;
+	--mapping->inFlight;
+	++mapping->done;
+
+	if(mapping->ordered) mapping->results[index] = data;
+	else mapping->results.append(data);
+
+	// Close the map stream when all items are processed,
+	// or when it was aborted and the last stream in flight settled
+	if(
+		mapping->done >= mapping->items.size()
+		|| (mapping->inFlight < 1 && mapping->handle.isAborted())
+	) {
+		mapping->settled = true;
+		mapping->handle.close(mapping->results);
+		return;
+	}
+
+	launchNext(mapping);
+}
+
+void quickstreams::MapExecutable::onFailed(
+	const MappingReference& mapping,
+	const QVariant& error
+) {
+	if(mapping->settled) return;
+	mapping->settled = true;
+
+	// Failing the map stream eliminates the streams still in flight
+	mapping->handle.fail(error);
+}
+
+void quickstreams::MapExecutable::onAborted(
+	const MappingReference& mapping,
+	int index,
+	const QVariant& reason
+) {
+	if(mapping->settled) return;
+	if(!mapping->handle.isAborted()) {
+		onFailed(mapping, QVariant::fromValue<Error>(Error(
+			exception::Exception::type(),
+			QString("mapped stream %1 was aborted").arg(index)
+		)));
+		return;
+	}
+
+	// Closing the aborted map stream awakes its abortion sequence
+	if(--mapping->inFlight > 0) return;
+	mapping->settled = true;
+	mapping->handle.close(reason);
+}
+
+void quickstreams::MapExecutable::execute(const QVariant& data) {
+	Q_UNUSED(data)
+
+	// Close right away if there's nothing to map
+	if(_items.isEmpty()) {
+		_handle->close(QVariantList());
+		return;
+	}
+
+	MappingReference mapping(new Mapping{
+		*_handle,
+		_factory,
+		_items,
+		QVariantList(),
+		_ordered,
+		0, 0, 0,
+		false,
+		0,
+		false
+	});
+
+	// Ordered results are stored at the index of their item
+	if(_ordered) {
+		for(int itr(0); itr < _items.size(); ++itr) {
+			mapping->results.append(QVariant());
+		}
+	}
+
+	for(int itr(0); itr < _maxInFlight; ++itr) launchNext(mapping);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Executable.hpp"
+#include "StreamHandle.hpp"
+#include "Stream.hpp"
+#include <functional>
+#include <QVariant>
+#include <QVariantList>
+#include <QSharedPointer>
+
+namespace quickstreams {
+
+class Provider;
+
+// The map executable pushes a list of items through streams created
+// by a factory keeping at most a given number of them in flight.
+// The streams are created lazily as soon as a slot frees up
+// and are adopted by the stream the executable belongs to.
+class MapExecutable : public Executable {
+	friend class Provider;
+
+public:
+	// Returns a new free stream processing the given item
+	typedef std::function<Stream::Reference(const QVariant& item)> Factory;
+
+protected:
+	// The mapping outlives the executable for the observers
+	// of the created streams to remain safe even if the map stream died
+	struct Mapping {
+		StreamHandle handle;
+		Factory factory;
+		QVariantList items;
+		QVariantList results;
+		bool ordered;
+		int next;
+		int inFlight;
+		int done;
+		bool settled;
+
+		// Launches requested while launching are counted and performed
+		// by the launch loop rather than by recursion
+		int launches;
+		bool launching;
+	};
+	typedef QSharedPointer<Mapping> MappingReference;
+
+	QVariantList _items;
+	Factory _factory;
+	int _maxInFlight;
+	bool _ordered;
+
+	MapExecutable(
+		const QVariantList& items,
+		Factory factory,
+		int maxInFlight,
+		bool ordered
+	);
+
+	// Launches the stream processing the next item if any is left.
+	// Streams settling within their launch don't recurse into it,
+	// the next items are launched by the loop of the outermost call
+	static void launchNext(const MappingReference& mapping);
+	static void launch(const MappingReference& mapping);
+
+	static void onClosed(
+		const MappingReference& mapping,
+		int index,
+		const QVariant& data
+	);
+	static void onFailed(
+		const MappingReference& mapping,
+		const QVariant& error
+	);
+
+	// Streams of an aborted map settle it into its abortion sequence
+	// once the last of them settled, streams aborted from outside
+	// can never close and are considered failed
+	static void onAborted(
+		const MappingReference& mapping,
+		int index,
+		const QVariant& reason
+	);
+
+public:
+	void execute(const QVariant& data);
+};
+
+} // quickstreams
@@ -2,21 +2,44 @@
 #include "Stream.hpp"
 #include "Executable.hpp"
 #include "LambdaExecutable.hpp"
+#include "CombinatorExecutable.hpp"
+#include "MapExecutable.hpp"
+#include "Transition.hpp"
+#include "StreamPool.hpp"
+#include <exception>
 #include <QObject>
 #include <QMetaObject>
+#include <QVariant>
+#include <QThread>
+#include <QMutexLocker>
+#include <QReadWriteLock>
+
+// Terminates the list of free handle slots
+static const quint32 NoSlot(~quint32(0));
 
 quickstreams::Provider::Provider(QObject* parent) :
 	QObject(parent),
-	_totalCreated(0),
-	_totalExisting(0),
-	_totalActive(0)
-{}
+	_dispatchScheduled(false),
+	_dispatchBudget(0),
+	_pooling(false),
+	_freeSlot(NoSlot),
+	_postedDispatchScheduled(false),
+	_statisticsInterval(-1),
+	_statisticsScheduled(false),
+	_notifiedCreated(0),
+	_notifiedExisting(0),
+	_notifiedActive(0)
+{
+	_statisticsTimer.setCallback([this]() {
+		notifyStatistics();
+	});
+}
 
 quickstreams::Stream::Reference quickstreams::Provider::internalCreate(
 	const Executable::Reference& executable,
 	quickstreams::Stream::Type type
 ) {
-	auto stream(new Stream(
+	auto stream(new (pool()) Stream(
 		this,
 		executable,
 		type,
@@ -25,50 +48,338 @@ quickstreams::Stream::Reference quickstreams::Provider::internalCreate(
 	Stream::Reference reference(stream, &Stream::deleteLater);
 	registerNew(reference);
 
-	QMetaObject::invokeMethod(
-		stream, "initialize",
-		Qt::QueuedConnection
-	);
+	schedule(Transition{reference, Transition::Kind::Initialize, QVariant()});
 
 	return reference;
 }
 
+quickstreams::Stream::Reference quickstreams::Provider::combine(
+	CombinatorExecutable::Mode mode,
+	const CombinatorExecutable::Members& streams
+) {
+	auto reference(internalCreate(
+		Executable::Reference(new CombinatorExecutable(mode, streams)),
+		Stream::Type::Abortable
+	));
+
+	// The combined streams are launched by the combinator
+	// instead of being launched on their own
+	for(
+		CombinatorExecutable::Members::const_iterator itr(streams.constBegin());
+		itr != streams.constEnd();
+		itr++
+	) {
+		if(itr->isNull()) throw std::logic_error(
+			"QuickStreams - FATAL ERROR: "
+			"Attempted to combine a null stream!"
+		);
+		(*itr)->verifyCombinable();
+		(*itr)->_captionStatus = Stream::CaptionStatus::Bound;
+		reference->adopt(*itr);
+	}
+	return reference;
+}
+
+quickstreams::Stream::Reference quickstreams::Provider::all(
+	const CombinatorExecutable::Members& streams
+) {
+	return combine(CombinatorExecutable::Mode::All, streams);
+}
+
+quickstreams::Stream::Reference quickstreams::Provider::any(
+	const CombinatorExecutable::Members& streams
+) {
+	return combine(CombinatorExecutable::Mode::Any, streams);
+}
+
+quickstreams::Stream::Reference quickstreams::Provider::race(
+	const CombinatorExecutable::Members& streams
+) {
+	return combine(CombinatorExecutable::Mode::Race, streams);
+}
+
+quickstreams::Stream::Reference quickstreams::Provider::mapConcurrent(
+	const QVariantList& items,
+	MapExecutable::Factory factory,
+	int maxInFlight,
+	bool ordered
+) {
+	return internalCreate(
+		Executable::Reference(
+			new MapExecutable(items, factory, maxInFlight, ordered)
+		),
+		Stream::Type::Abortable
+	);
+}
+
+quickstreams::Stream::Reference quickstreams::Provider::hedge(
+	HedgeExecutable::Factory factory,
+	const HedgePolicy::Reference& policy,
+	int maxAttempts
+) {
+	return internalCreate(
+		Executable::Reference(
+			new HedgeExecutable(factory, policy, maxAttempts, &_timers)
+		),
+		Stream::Type::Abortable
+	);
+}
+
 void quickstreams::Provider::registerNew(const Stream::Reference& reference) {
-	_references.insert(reference.data(), reference);
+	// Only the provider thread writes the reference field of a slot,
+	// other threads only read the stream pointer and the generation
+	_slots[reference->slot()].reference = reference;
 
 	// Update statistics
-	++_totalCreated;
-	++_totalExisting;
-	totalCreatedChanged();
-	totalExistingChanged();
+	_totalCreated.increment();
+	_totalExisting.increment();
+	statisticsChanged();
 }
 
 void quickstreams::Provider::activated() {
 	// Update statistics
-	++_totalActive;
-	totalActiveChanged();
+	_totalActive.increment();
+	statisticsChanged();
 }
 
 void quickstreams::Provider::finished() {
 	// Update statistics
-	--_totalActive;
-	totalActiveChanged();
+	_totalActive.decrement();
+	statisticsChanged();
 }
 
 void quickstreams::Provider::destroyed() {
 	// Update statistics
-	--_totalExisting;
-	totalExistingChanged();
+	_totalExisting.decrement();
+	statisticsChanged();
+}
+
+void quickstreams::Provider::statisticsChanged() {
+	// The counters are thread-safe but the notification
+	// is always emitted on the provider thread
+	if(!isOwnerThread()) {
+		post([this]() {
+			statisticsChanged();
+		});
+		return;
+	}
+
+	if(_statisticsInterval < 0) {
+		notifyStatistics();
+		return;
+	}
+
+	// Schedule a single notification no matter how many changes follow
+	if(_statisticsScheduled) return;
+	_statisticsScheduled = true;
+	if(_statisticsInterval < 1) {
+		QMetaObject::invokeMethod(
+			this, "notifyStatistics", Qt::QueuedConnection
+		);
+	} else {
+		_timers.schedule(&_statisticsTimer, _statisticsInterval);
+	}
+}
+
+void quickstreams::Provider::notifyStatistics() {
+	_statisticsScheduled = false;
+
+	// Counters that changed back to their notified value are not notified
+	const quint64 created(_totalCreated.load());
+	const quint64 existing(_totalExisting.load());
+	const quint64 active(_totalActive.load());
+	if(_notifiedCreated != created) {
+		_notifiedCreated = created;
+		totalCreatedChanged();
+	}
+	if(_notifiedExisting != existing) {
+		_notifiedExisting = existing;
+		totalExistingChanged();
+	}
+	if(_notifiedActive != active) {
+		_notifiedActive = active;
+		totalActiveChanged();
+	}
 }
 
 void quickstreams::Provider::dispose(Stream* stream) {
-	_references.erase(_references.find(stream));
+	_slots[stream->slot()].reference.clear();
 }
 
 quickstreams::Stream::Reference quickstreams::Provider::reference(
 	Stream* stream
 ) const {
-	return _references.constFind(stream).value();
+	return _slots.at(stream->slot()).reference;
+}
+
+void quickstreams::Provider::schedule(Transition transition) {
+	_transitions.enqueue(Transition());
+	_transitions.last().swap(transition);
+	scheduleDispatch();
+}
+
+void quickstreams::Provider::scheduleDispatch() {
+	// Post a single dispatch event per event loop cycle
+	// no matter how many transitions are scheduled
+	if(_dispatchScheduled) return;
+	_dispatchScheduled = true;
+	QMetaObject::invokeMethod(this, "dispatch", Qt::QueuedConnection);
+}
+
+void quickstreams::Provider::dispatch() {
+	_dispatchScheduled = false;
+
+	// Dispatch only the transitions scheduled before this batch,
+	// transitions scheduled during the dispatch are deferred
+	// to the next event loop cycle
+	int count(_transitions.size());
+	if(_dispatchBudget > 0 && count > _dispatchBudget) count = _dispatchBudget;
+
+	for(int itr(0); itr < count && !_transitions.isEmpty(); ++itr) {
+		// Release the target reference only after the transition is dispatched
+		Transition transition;
+		transition.swap(_transitions.first());
+		_transitions.removeFirst();
+		transition.target->dispatch(transition);
+	}
+
+	if(!_transitions.isEmpty()) scheduleDispatch();
+}
+
+void quickstreams::Provider::post(const Scheduler::Task& task) {
+	QMutexLocker lock(&_postedLock);
+	_posted.enqueue(task);
+
+	// Post a single event no matter how many tasks are posted
+	if(_postedDispatchScheduled) return;
+	_postedDispatchScheduled = true;
+	QMetaObject::invokeMethod(this, "dispatchPosted", Qt::QueuedConnection);
+}
+
+void quickstreams::Provider::dispatchPosted() {
+	TaskQueue posted;
+	{
+		QMutexLocker lock(&_postedLock);
+		posted.swap(_posted);
+		_postedDispatchScheduled = false;
+	}
+	while(!posted.isEmpty()) posted.dequeue()();
+}
+
+bool quickstreams::Provider::isOwnerThread() const {
+	return QThread::currentThread() == thread();
+}
+
+void quickstreams::Provider::setScheduler(
+	const Scheduler::Reference& scheduler
+) {
+	_scheduler = scheduler;
+}
+
+quickstreams::Scheduler* quickstreams::Provider::scheduler() const {
+	return _scheduler.data();
+}
+
+void quickstreams::Provider::setDispatchBudget(int budget) {
+	_dispatchBudget = budget < 0 ? 0 : budget;
+}
+
+int quickstreams::Provider::dispatchBudget() const {
+	return _dispatchBudget;
+}
+
+quickstreams::CircuitBreaker::Reference
+quickstreams::Provider::circuitBreaker(
+	const QString& name,
+	const CircuitBreaker::Policy& policy
+) {
+	CircuitBreakers::const_iterator itr(_circuitBreakers.constFind(name));
+	if(itr != _circuitBreakers.constEnd()) return *itr;
+	CircuitBreaker::Reference breaker(new CircuitBreaker(name, policy));
+	_circuitBreakers.insert(name, breaker);
+	return breaker;
+}
+
+quickstreams::ExceptionTranslator*
+quickstreams::Provider::exceptionTranslator() {
+	return &_exceptionTranslator;
+}
+
+const quickstreams::ExceptionTranslator*
+quickstreams::Provider::exceptionTranslator() const {
+	return &_exceptionTranslator;
+}
+
+quickstreams::TimerWheel* quickstreams::Provider::timers() {
+	return &_timers;
+}
+
+quickstreams::StreamPool* quickstreams::Provider::pool() const {
+	if(!_pooling) return nullptr;
+	return _pool.data();
+}
+
+void quickstreams::Provider::setStreamPooling(bool enabled) {
+	// The pool is kept alive even after the pooling is disabled
+	// because previously pooled streams are released to it
+	if(enabled && _pool.isNull()) {
+		_pool.reset(new StreamPool(Stream::AllocationSize));
+	}
+	_pooling = enabled;
+}
+
+void quickstreams::Provider::acquireSlot(
+	Stream* stream,
+	quint32& slot,
+	quint32& generation
+) {
+	QWriteLocker lock(&_slotsLock);
+	if(_freeSlot == NoSlot) {
+		slot = quint32(_slots.size());
+		_slots.append(HandleSlot{stream, 0, NoSlot, Stream::Reference()});
+	} else {
+		slot = _freeSlot;
+		_freeSlot = _slots[slot].nextFree;
+		_slots[slot].stream = stream;
+		_slots[slot].nextFree = NoSlot;
+	}
+	generation = _slots[slot].generation;
+}
+
+void quickstreams::Provider::releaseSlot(quint32 slot) {
+	QWriteLocker lock(&_slotsLock);
+	auto& released(_slots[slot]);
+	released.stream = nullptr;
+	++released.generation;
+	released.nextFree = _freeSlot;
+	_freeSlot = slot;
+}
+
+quint32 quickstreams::Provider::renewSlot(quint32 slot) {
+	QWriteLocker lock(&_slotsLock);
+	return ++_slots[slot].generation;
+}
+
+quickstreams::Stream* quickstreams::Provider::resolveSlot(
+	quint32 slot,
+	quint32 generation
+) const {
+	if(slot >= quint32(_slots.size())) return nullptr;
+	const auto& resolved(_slots.at(slot));
+	if(resolved.generation != generation) return nullptr;
+	return resolved.stream;
+}
+
+void quickstreams::Provider::lockSlots() const {
+	if(!isOwnerThread()) _slotsLock.lockForRead();
+}
+
+void quickstreams::Provider::unlockSlots() const {
+	if(!isOwnerThread()) _slotsLock.unlock();
+}
+
+bool quickstreams::Provider::streamPooling() const {
+	return _pooling;
 }
 
 quickstreams::Stream::Reference quickstreams::Provider::create(
@@ -81,14 +392,38 @@ quickstreams::Stream::Reference quickstreams::Provider::create(
 	);
 }
 
+void quickstreams::Provider::setStatisticsInterval(int interval) {
+	_statisticsInterval = interval < -1 ? -1 : interval;
+
+	// Flush pending changes so they're not notified
+	// according to the previous interval
+	if(!_statisticsScheduled) return;
+	_statisticsTimer.cancel();
+	notifyStatistics();
+}
+
+int quickstreams::Provider::statisticsInterval() const {
+	return _statisticsInterval;
+}
+
 quint64 quickstreams::Provider::totalCreated() const {
-	return _totalCreated;
+	return _totalCreated.load();
 }
 
 quint64 quickstreams::Provider::totalExisting() const {
-	return _totalExisting;
+	return _totalExisting.load();
 }
 
 quint64 quickstreams::Provider::totalActive() const {
-	return _totalActive;
+	return _totalActive.load();
+}
+
+quint64 quickstreams::Provider::poolHits() const {
+	if(_pool.isNull()) return 0;
+	return _pool->hits();
+}
+
+quint64 quickstreams::Provider::poolMisses() const {
+	if(_pool.isNull()) return 0;
+	return _pool->misses();
 }
@@ -4,8 +4,24 @@
 #include "Stream.hpp"
 #include "Executable.hpp"
 #include "LambdaExecutable.hpp"
+#include "CombinatorExecutable.hpp"
+#include "MapExecutable.hpp"
+#include "HedgeExecutable.hpp"
+#include "HedgePolicy.hpp"
+#include "Transition.hpp"
+#include "StreamPool.hpp"
+#include "Scheduler.hpp"
+#include "TimerWheel.hpp"
+#include "ShardedCounter.hpp"
+#include "CircuitBreaker.hpp"
+#include "ExceptionTranslator.hpp"
 #include <QObject>
 #include <QHash>
+#include <QQueue>
+#include <QVector>
+#include <QScopedPointer>
+#include <QMutex>
+#include <QReadWriteLock>
 
 #include <QString>
 
@@ -22,25 +38,88 @@ class Provider : public QObject, public ProviderInterface {
 	friend class qml::StreamConversion;
 
 protected:
-	typedef QHash<Stream*, Stream::Reference> ReferenceMap;
+	typedef QQueue<Transition> TransitionQueue;
+	typedef QQueue<Scheduler::Task> TaskQueue;
+	typedef QHash<QString, CircuitBreaker::Reference> CircuitBreakers;
+
+	// Each stream occupies a slot for its entire lifetime. The slot holds
+	// the owning reference of the stream until it's disposed, the stream
+	// knows its slot index thus its reference is found without hashing
+	struct HandleSlot {
+		Stream* stream;
+		quint32 generation;
+		quint32 nextFree;
+		Stream::Reference reference;
+	};
+	typedef QVector<HandleSlot> HandleSlots;
 
 protected:
-	ReferenceMap _references;
-	quint64 _totalCreated;
-	quint64 _totalExisting;
-	quint64 _totalActive;
+	ShardedCounter _totalCreated;
+	ShardedCounter _totalExisting;
+	ShardedCounter _totalActive;
+	TransitionQueue _transitions;
+	bool _dispatchScheduled;
+	int _dispatchBudget;
+	QScopedPointer<StreamPool, StreamPool::Disposer> _pool;
+	bool _pooling;
+	HandleSlots _slots;
+	quint32 _freeSlot;
+	mutable QReadWriteLock _slotsLock;
+	Scheduler::Reference _scheduler;
+	QMutex _postedLock;
+	TaskQueue _posted;
+	bool _postedDispatchScheduled;
+	TimerWheel _timers;
+	CircuitBreakers _circuitBreakers;
+	ExceptionTranslator _exceptionTranslator;
+	int _statisticsInterval;
+	bool _statisticsScheduled;
+	TimerWheel::Timer _statisticsTimer;
+	quint64 _notifiedCreated;
+	quint64 _notifiedExisting;
+	quint64 _notifiedActive;
 
 	Stream::Reference internalCreate(
 		const Executable::Reference& executable,
 		Stream::Type type = Stream::Type::Atomic
 	);
 
+	Stream::Reference combine(
+		CombinatorExecutable::Mode mode,
+		const CombinatorExecutable::Members& streams
+	);
+
 	void registerNew(const Stream::Reference& reference);
 	void activated();
 	void finished();
 	void destroyed();
+	void statisticsChanged();
 	void dispose(Stream* stream);
 	Stream::Reference reference(Stream* stream) const;
+	void schedule(Transition transition);
+	void scheduleDispatch();
+	StreamPool* pool() const;
+	void acquireSlot(Stream* stream, quint32& slot, quint32& generation);
+	void releaseSlot(quint32 slot);
+	quint32 renewSlot(quint32 slot);
+	Stream* resolveSlot(quint32 slot, quint32 generation) const;
+	void lockSlots() const;
+	void unlockSlots() const;
+	bool isOwnerThread() const;
+	void post(const Scheduler::Task& task);
+	TimerWheel* timers();
+
+protected slots:
+	// Dispatches all transitions scheduled until now in a single batch
+	// but no more than the dispatch budget allows
+	void dispatch();
+
+	// Executes all tasks posted from other threads until now
+	void dispatchPosted();
+
+	// Emits the change signals of all statistics counters
+	// that changed since they were last notified
+	void notifyStatistics();
 
 public:
 	explicit Provider(QObject* parent = nullptr);
@@ -49,9 +128,98 @@ public:
 		Stream::Type type = Stream::Type::Atomic
 	);
 
+	// all, any and race are combinators. They return a new abortable stream
+	// that launches the given free streams concurrently when it's awoken
+	// passing them the data it was awoken with. The combined streams
+	// are adopted by the returned stream and are aborted along with it.
+	//
+	// all closes with the list of the close data of all streams
+	// and fails as soon as any of the streams fails.
+	// any closes with the close data of the first stream to close
+	// and fails only if all streams fail.
+	// race closes or fails just like the first stream to settle.
+	// The streams that didn't win are aborted.
+	Stream::Reference all(const CombinatorExecutable::Members& streams);
+	Stream::Reference any(const CombinatorExecutable::Members& streams);
+	Stream::Reference race(const CombinatorExecutable::Members& streams);
+
+	// mapConcurrent returns a new abortable stream that, when awoken,
+	// pushes each item through a free stream created by the factory keeping
+	// at most maxInFlight streams running at a time. New streams are created
+	// lazily as running ones settle. It closes with the list of the close
+	// data of all created streams, either in the order of the items
+	// or in the order of completion if not ordered, and fails as soon
+	// as any of the created streams fails. When aborted the streams
+	// in flight are aborted and no further streams are created.
+	Stream::Reference mapConcurrent(
+		const QVariantList& items,
+		MapExecutable::Factory factory,
+		int maxInFlight = 1,
+		bool ordered = true
+	);
+
+	// hedge returns a new abortable stream that, when awoken, launches
+	// a free stream created by the factory passing it the data it was
+	// awoken with. Whenever the latest attempt didn't settle within
+	// the threshold of the hedge policy a duplicate attempt is launched
+	// until maxAttempts attempts are running. The first attempt to close
+	// wins and the others are aborted. A failed attempt is replaced
+	// by the next attempt right away, the hedge stream only fails when
+	// all attempts failed. Only hedge idempotent operations.
+	// The policy is usually shared by all hedged calls of an operation,
+	// a null policy creates a default one for this call only.
+	Stream::Reference hedge(
+		HedgeExecutable::Factory factory,
+		const HedgePolicy::Reference& policy = HedgePolicy::Reference(),
+		int maxAttempts = 2
+	);
+
+	// Limits the number of transitions dispatched per event loop cycle
+	// to keep the event loop responsive. Remaining transitions are
+	// dispatched in the following cycles. 0 disables the limit (default)
+	void setDispatchBudget(int budget);
+	int dispatchBudget() const;
+
+	// Enables allocating streams in a pool of recycled memory blocks
+	// instead of allocating each stream on the heap. Streams allocated
+	// before the pooling was disabled are still released to the pool
+	void setStreamPooling(bool enabled);
+	bool streamPooling() const;
+
+	// Sets the scheduler executing the executables of offloaded streams
+	// on worker threads. Without a scheduler offloaded streams
+	// are executed on the provider thread
+	void setScheduler(const Scheduler::Reference& scheduler);
+	Scheduler* scheduler() const;
+
+	// Returns the translator of exceptions thrown by the C++ executables
+	// of this provider. Add translations of custom exception types to it
+	// before streams throwing them are executed
+	ExceptionTranslator* exceptionTranslator();
+	const ExceptionTranslator* exceptionTranslator() const;
+
+	// Returns the circuit breaker registered under the given name
+	// creating it with the given policy if it doesn't exist yet.
+	// The policy of an existing circuit breaker is not changed
+	CircuitBreaker::Reference circuitBreaker(
+		const QString& name,
+		const CircuitBreaker::Policy& policy = CircuitBreaker::Policy()
+	);
+
+	// Sets how changes of the statistics counters are notified.
+	// -1 emits the change signals on every change (default),
+	// 0 coalesces all changes into a single notification
+	// per event loop cycle and a positive interval notifies
+	// at most once per interval milliseconds.
+	// The counters themselves are always exact
+	void setStatisticsInterval(int interval);
+	int statisticsInterval() const;
+
 	quint64 totalCreated() const;
 	quint64 totalExisting() const;
 	quint64 totalActive() const;
+	quint64 poolHits() const;
+	quint64 poolMisses() const;
 
 signals:
 	void totalCreatedChanged();
@@ -1,5 +1,12 @@
 #pragma once
 
+#include "Transition.hpp"
+#include "StreamPool.hpp"
+#include "Scheduler.hpp"
+#include "TimerWheel.hpp"
+#include "CircuitBreaker.hpp"
+#include "ExceptionTranslator.hpp"
+#include <QString>
 #include <QSharedPointer>
 
 namespace quickstreams {
@@ -17,10 +24,60 @@ public:
 
 	virtual void registerNew(const QSharedPointer<Stream>& stream) = 0;
 	virtual QSharedPointer<Stream> reference(Stream* stream) const = 0;
+	virtual void schedule(Transition transition) = 0;
+
+	// Returns the pool new streams are allocated in
+	// or null if they're to be allocated on the heap
+	virtual StreamPool* pool() const = 0;
+
+	// Stream handles refer to streams through generational slots.
+	// A released slot is reused with an incremented generation
+	// which invalidates all handles still referring to it
+	virtual void acquireSlot(
+		Stream* stream,
+		quint32& slot,
+		quint32& generation
+	) = 0;
+	virtual void releaseSlot(quint32 slot) = 0;
+
+	// Increments the generation of an occupied slot invalidating
+	// all handles still referring to it and returns the new generation
+	virtual quint32 renewSlot(quint32 slot) = 0;
+	virtual Stream* resolveSlot(quint32 slot, quint32 generation) const = 0;
+
+	// Locks the slots for reading when called outside of the provider thread
+	// preventing the resolved streams from being destroyed while inspected
+	virtual void lockSlots() const = 0;
+	virtual void unlockSlots() const = 0;
+
+	// Returns true if called from the thread the provider lives in
+	virtual bool isOwnerThread() const = 0;
+
+	// Executes the task on the provider thread in a later event loop cycle.
+	// Thread-safe
+	virtual void post(const Scheduler::Task& task) = 0;
+
+	// Returns the scheduler executing offloaded streams if any
+	virtual Scheduler* scheduler() const = 0;
+
+	// Returns the timer wheel driving the timers of all streams
+	virtual TimerWheel* timers() = 0;
+
+	// Returns the translator of exceptions thrown by C++ executables
+	virtual const ExceptionTranslator* exceptionTranslator() const = 0;
+
+	// Returns the circuit breaker registered under the given name
+	// creating it with the given policy if it doesn't exist yet
+	virtual CircuitBreaker::Reference circuitBreaker(
+		const QString& name,
+		const CircuitBreaker::Policy& policy
+	) = 0;
 
 	virtual quint64 totalCreated() const = 0;
 	virtual quint64 totalExisting() const = 0;
 	virtual quint64 totalActive() const = 0;
+	virtual quint64 poolHits() const = 0;
+	virtual quint64 poolMisses() const = 0;
 };
 
 }
@@ -96,6 +96,14 @@ int quickstreams::qml::ExceptionTypeList::SystemError() {
 	return quickstreams::exception::SystemError::type();
 }
 
+int quickstreams::qml::ExceptionTypeList::TimeoutError() {
+	return quickstreams::exception::TimeoutError::type();
+}
+
+int quickstreams::qml::ExceptionTypeList::CircuitOpenError() {
+	return quickstreams::exception::CircuitOpenError::type();
+}
+
 quickstreams::qml::ExceptionTypeList
 quickstreams::qml::QmlProvider::exceptions() const {
 	return exceptionTypes;
@@ -126,8 +134,7 @@ quickstreams::qml::QmlProvider::QmlProvider(
 quickstreams::qml::QmlStream* quickstreams::qml::QmlProvider::toQml(
 	const quickstreams::Stream::Reference& stream
 ) {
-	if(stream.isNull()) return nullptr;
-	return new QmlStream(_engine, stream);
+	return QmlStream::wrap(_engine, stream);
 }
 
 quickstreams::qml::QmlStream* quickstreams::qml::QmlProvider::create(
@@ -136,14 +143,14 @@ quickstreams::qml::QmlStream* quickstreams::qml::QmlProvider::create(
 ) {
 	// If target is not callable then there's no executable
 	if(!target.isCallable()) {
-		return new QmlStream(_engine, _provider->internalCreate(
+		return QmlStream::wrap(_engine, _provider->internalCreate(
 			Executable::Reference(nullptr), type)
 		);
 	}
 
 	// Otherwise create executable out of a js function
 	auto jsExec(new JsExecutable(_engine, target));
-	auto stream(new QmlStream(_engine, _provider->internalCreate(
+	auto stream(QmlStream::wrap(_engine, _provider->internalCreate(
 		Executable::Reference(jsExec), type
 	)));
 
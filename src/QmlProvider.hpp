@@ -35,6 +35,8 @@ class ExceptionTypeList {
 	Q_PROPERTY(int UnderflowError READ UnderflowError CONSTANT)
 	Q_PROPERTY(int RegexError READ RegexError CONSTANT)
 	Q_PROPERTY(int SystemError READ SystemError CONSTANT)
+	Q_PROPERTY(int TimeoutError READ TimeoutError CONSTANT)
+	Q_PROPERTY(int CircuitOpenError READ CircuitOpenError CONSTANT)
 
 public:
 	static int Exception();
@@ -58,6 +60,8 @@ public:
 	static int UnderflowError();
 	static int RegexError();
 	static int SystemError();
+	static int TimeoutError();
+	static int CircuitOpenError();
 };
 
 class QmlProvider : public QObject {
@@ -8,6 +8,8 @@
 #include "JsRepeater.hpp"
 #include "JsConditionRetryer.hpp"
 #include "JsTypeRetryer.hpp"
+#include "TypeRetryer.hpp"
+#include "BackoffRetryer.hpp"
 #include "ProviderInterface.hpp"
 #include <QJSValue>
 #include <QString>
@@ -43,29 +45,64 @@ quickstreams::qml::QmlStream::QmlStream(
 	QObject(nullptr),
 	_engine(engine),
 	_reference(reference),
-	_handle(
-		&_reference->_handle,
-		// Called when qml stream is requested to adopt another qml stream
-		[this](QmlStream* another) {
-			if(!another) {
-				another = new QmlStream(
-					_engine,
-					_reference->create(
-						nullptr,
-						quickstreams::Stream::Type::Atomic,
-						quickstreams::Stream::CaptionStatus::Bound
-					)
-				);
-			}
-			_reference->adopt(another->_reference);
-			return another;
-		},
-		// Called when qmlstream reference is requested
-		[this]() {
-			return this;
-		}
-	)
-{}
+	_handle(_reference->_handle, engine)
+{
+	_reference->_qmlStream = this;
+}
+
+quickstreams::qml::QmlStream::~QmlStream() {
+	release();
+}
+
+quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::wrap(
+	QQmlEngine* engine,
+	const quickstreams::Stream::Reference& reference
+) {
+	if(reference.isNull()) return nullptr;
+	if(reference->_qmlStream) return reference->_qmlStream;
+	auto stream(new QmlStream(engine, reference));
+
+	// A disposed stream won't die again to release its wrapper
+	if(reference->isDisposed()) stream->release();
+	return stream;
+}
+
+void quickstreams::qml::QmlStream::release() {
+	if(_reference.isNull()) return;
+	if(_reference->_qmlStream == this) _reference->_qmlStream = nullptr;
+	_reference.clear();
+}
+
+void quickstreams::qml::QmlStream::renewHandle() {
+	if(_reference.isNull()) return;
+	_handle._handle = _reference->_handle;
+}
+
+quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::adopt(
+	QmlStream* another
+) {
+	if(_reference.isNull()) return another;
+	return adopt(_engine, _reference.data(), another);
+}
+
+quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::adopt(
+	QQmlEngine* engine,
+	quickstreams::Stream* target,
+	QmlStream* another
+) {
+	if(!another) {
+		another = wrap(
+			engine,
+			target->create(
+				nullptr,
+				quickstreams::Stream::Type::Atomic,
+				quickstreams::Stream::CaptionStatus::Bound
+			)
+		);
+	}
+	if(!another->_reference.isNull()) target->adopt(another->_reference);
+	return another;
+}
 
 quickstreams::qml::StreamConversion quickstreams::qml::QmlStream::fromJsValue(
 	const QJSValue& value,
@@ -74,7 +111,7 @@ quickstreams::qml::StreamConversion quickstreams::qml::QmlStream::fromJsValue(
 	if(value.isCallable()) {
 		// Return a newly created wrapper wrapping a new stream
 		auto jsExec(new JsSyncExecutable(_engine, value));
-		auto stream(new QmlStream(_engine, _reference->create(
+		auto stream(wrap(_engine, _reference->create(
 			Executable::Reference(jsExec), type,
 			quickstreams::Stream::CaptionStatus::Free
 		)));
@@ -88,7 +125,7 @@ quickstreams::qml::StreamConversion quickstreams::qml::QmlStream::fromJsValue(
 	}
 
 	//Otherwise return a newly created wrapper wrapping a new (dry) stream
-	return StreamConversion(new QmlStream(_engine, _reference->create(
+	return StreamConversion(wrap(_engine, _reference->create(
 		nullptr, type, quickstreams::Stream::CaptionStatus::Free
 	)));
 }
@@ -96,37 +133,120 @@ quickstreams::qml::StreamConversion quickstreams::qml::QmlStream::fromJsValue(
 quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::delay(
 	const QJSValue& duration
 ) {
+	if(_reference.isNull()) return this;
 	if(!duration.isNumber()) return this;
 	_reference->delay(duration.toInt());
 	return this;
 }
 
+quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::timeout(
+	const QJSValue& duration
+) {
+	if(_reference.isNull()) return this;
+	if(!duration.isNumber()) return this;
+	_reference->timeout(duration.toInt());
+	return this;
+}
+
+quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::guard(
+	const QJSValue& name,
+	const QJSValue& policy
+) {
+	if(_reference.isNull()) return this;
+	if(!name.isString()) return this;
+
+	CircuitBreaker::Policy defaults;
+	int windowSize(defaults.windowSize);
+	double failureRateThreshold(defaults.failureRateThreshold);
+	qint32 openDuration(defaults.openDuration);
+	int halfOpenProbes(defaults.halfOpenProbes);
+	int minimumCalls(defaults.minimumCalls);
+	if(policy.isObject()) {
+		if(policy.property("windowSize").isNumber()) {
+			windowSize = policy.property("windowSize").toInt();
+		}
+		if(policy.property("failureRateThreshold").isNumber()) {
+			failureRateThreshold =
+				policy.property("failureRateThreshold").toNumber();
+		}
+		if(policy.property("openDuration").isNumber()) {
+			openDuration = policy.property("openDuration").toInt();
+		}
+		if(policy.property("halfOpenProbes").isNumber()) {
+			halfOpenProbes = policy.property("halfOpenProbes").toInt();
+		}
+		if(policy.property("minimumCalls").isNumber()) {
+			minimumCalls = policy.property("minimumCalls").toInt();
+		}
+	}
+
+	_reference->guard(_reference->_provider->circuitBreaker(
+		name.toString(),
+		CircuitBreaker::Policy(
+			windowSize,
+			failureRateThreshold,
+			openDuration,
+			halfOpenProbes,
+			minimumCalls
+		)
+	));
+	return this;
+}
+
 quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::retry(
 	const QJSValue& condition,
-	const QJSValue& maxTrials
+	const QJSValue& maxTrials,
+	const QJSValue& backoff
 ) {
+	if(_reference.isNull()) return this;
 	int trials(-1);
 	if(maxTrials.isNumber()) trials = maxTrials.toInt();
 
+	Retryer::Reference retryer;
 	if(condition.isCallable()) {
-		_reference->retry(Retryer::Reference(
-			new JsConditionRetryer(_engine, condition, trials)
-		));
+		retryer.reset(new JsConditionRetryer(_engine, condition, trials));
 	} else if(
 		condition.isNumber() || condition.isString() || condition.isArray()
 	) {
-		_reference->retry(Retryer::Reference(
-			new JsTypeRetryer(condition.toVariant(), trials)
-		));
+		retryer.reset(new JsTypeRetryer(condition.toVariant(), trials));
 	} else {
-		_reference->retry({condition.toInt()}, trials);
+		retryer.reset(new TypeRetryer({condition.toInt()}, trials));
+	}
+
+	// Back off before retrials if a backoff policy is given
+	if(backoff.isObject()) {
+		BackoffRetryer::Policy policy;
+		if(backoff.property("initialDelay").isNumber()) {
+			policy.initialDelay = backoff.property("initialDelay").toInt();
+		}
+		if(backoff.property("maxDelay").isNumber()) {
+			policy.maxDelay = backoff.property("maxDelay").toInt();
+		}
+		if(backoff.property("multiplier").isNumber()) {
+			policy.multiplier = backoff.property("multiplier").toNumber();
+		}
+		const QString jitter(backoff.property("jitter").toString());
+		if(jitter == "none") {
+			policy.jitter = BackoffRetryer::Jitter::None;
+		} else if(jitter == "decorrelated") {
+			policy.jitter = BackoffRetryer::Jitter::Decorrelated;
+		}
+		retryer.reset(new BackoffRetryer(retryer, BackoffRetryer::Policy(
+			policy.initialDelay,
+			policy.maxDelay,
+			policy.jitter,
+			policy.multiplier
+		), trials));
 	}
+
+	_reference->retry(retryer);
 	return this;
 }
 
 quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::repeat(
 	const QJSValue& condition
 ) {
+	if(_reference.isNull()) return this;
 	if(!condition.isCallable()) return this;
 	_reference->repeat(JsRepeater::Reference(new JsRepeater(condition)));
 	return this;
@@ -135,10 +255,12 @@ quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::repeat(
 quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::attach(
 	const QJSValue& target
 ) {
+	if(_reference.isNull()) return this;
 	auto conversion(fromJsValue(
 		target,
 		quickstreams::Stream::Type::Abortable
 	));
+	if(conversion.stream->_reference.isNull()) return this;
 
 	// If the referenced stream returns itself from the attach operator then
 	// there was an error, thus return this wrapper instead of the other one
@@ -152,10 +274,12 @@ quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::attach(
 quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::bind(
 	const QJSValue& target
 ) {
+	if(_reference.isNull()) return this;
 	auto conversion(fromJsValue(
 		target,
 		quickstreams::Stream::Type::Abortable
 	));
+	if(conversion.stream->_reference.isNull()) return this;
 
 	// If the referenced stream returns itself from the bind operator then
 	// there was an error, thus return this wrapper instead of the other one
@@ -170,6 +294,7 @@ quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::event(
 	const QVariant& name,
 	const QJSValue& callback
 ) {
+	if(_reference.isNull()) return this;
 	if(!name.canConvert<QString>()) return this;
 	_reference->event(
 		name.toString(),
@@ -181,10 +306,12 @@ quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::event(
 quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::failure(
 	const QJSValue& target
 ) {
+	if(_reference.isNull()) return this;
 	auto conversion(fromJsValue(
 		target,
 		quickstreams::Stream::Type::Atomic
 	));
+	if(conversion.stream->_reference.isNull()) return this;
 
 	// If the referenced stream returns itself from the failure operator then
 	// there was an error, thus return this wrapper instead of the other one
@@ -198,10 +325,12 @@ quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::failure(
 quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::abortion(
 	const QJSValue& target
 ) {
+	if(_reference.isNull()) return this;
 	auto conversion(fromJsValue(
 		target,
 		quickstreams::Stream::Type::Atomic
 	));
+	if(conversion.stream->_reference.isNull()) return this;
 
 	// If the referenced stream returns itself from the abortion operator then
 	// there was an error, thus return this wrapper instead of the other one
@@ -213,14 +342,17 @@ quickstreams::qml::QmlStream* quickstreams::qml::QmlStream::abortion(
 }
 
 void quickstreams::qml::QmlStream::abort() {
+	if(_reference.isNull()) return;
 	_reference->abort();
 }
 
 bool quickstreams::qml::QmlStream::isAbortable() const {
+	if(_reference.isNull()) return _handle.isAbortable();
 	return _reference->isAbortable();
 }
 
 bool quickstreams::qml::QmlStream::isAborted() const {
+	if(_reference.isNull()) return _handle.isAborted();
 	return _reference->isAborted();
 }
 
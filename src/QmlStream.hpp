@@ -45,6 +45,8 @@ class QmlStream : public QObject {
 	friend class StreamConversion;
 	friend class JsExecutable;
 	friend class JsSyncExecutable;
+	friend class QmlStreamHandle;
+	friend class quickstreams::Stream;
 
 protected:
 	QQmlEngine* _engine;
@@ -55,6 +57,35 @@ protected:
 		QQmlEngine* engine,
 		quickstreams::Stream::Reference reference
 	);
+
+	// Returns the wrapper of the stream creating it
+	// only if the stream isn't wrapped yet. Each stream has
+	// at most one wrapper which is released when the stream dies
+	static QmlStream* wrap(
+		QQmlEngine* engine,
+		const quickstreams::Stream::Reference& reference
+	);
+
+	// Releases the wrapped stream. Called when the stream dies
+	// to not keep it alive until the wrapper is garbage collected.
+	// Operators of released wrappers are ignored
+	void release();
+
+	// Refers the handle to the current trial of the wrapped stream
+	void renewHandle();
+
+	// Adopts the wrapped stream of another wrapper
+	// or a new dry stream if there's none
+	QmlStream* adopt(QmlStream* another);
+
+	// Makes the target adopt the wrapped stream of another wrapper
+	// or a new dry stream wrapped for the engine if there's none
+	static QmlStream* adopt(
+		QQmlEngine* engine,
+		quickstreams::Stream* target,
+		QmlStream* another
+	);
+
 	StreamConversion fromJsValue(
 		const QJSValue& value,
 		quickstreams::Stream::Type type
@@ -62,6 +93,8 @@ protected:
 
 
 public:
+	~QmlStream();
+
 	// delay is a stream operator, it delays the awakening of the stream
 	// for the given amount of milliseconds. If the stream is abortable
 	// and aborted during the delay - the delay timer is stopped,
@@ -69,11 +102,29 @@ public:
 	// the delay will block abortion until the stream is finally awoken.
 	Q_INVOKABLE QmlStream* delay(const QJSValue& duration);
 
+	// timeout is a stream operator, it fails the stream with a TimeoutError
+	// if it doesn't settle within the given amount of milliseconds
+	// after it was awoken.
+	Q_INVOKABLE QmlStream* timeout(const QJSValue& duration);
+
+	// guard is a stream operator, it guards the stream by the circuit breaker
+	// registered under the given name. The optional policy object may define
+	// the windowSize, failureRateThreshold, openDuration, halfOpenProbes
+	// and minimumCalls of the circuit breaker if it doesn't exist yet.
+	Q_INVOKABLE QmlStream* guard(
+		const QJSValue& name,
+		const QJSValue& policy = QJSValue()
+	);
+
 	// retry is a stream operator, it repeats resurrecting the current stream
 	// if either of the given error samples match the catched error.
+	// The optional backoff policy object may define the initialDelay,
+	// maxDelay and multiplier as well as the jitter
+	// which is either "none", "full" (default) or "decorrelated".
 	Q_INVOKABLE QmlStream* retry(
 		const QJSValue& condition,
-		const QJSValue& maxTrials = QJSValue()
+		const QJSValue& maxTrials = QJSValue(),
+		const QJSValue& backoff = QJSValue()
 	);
 
 	// repeat is a stream operator, it repeats resurrecting the current stream
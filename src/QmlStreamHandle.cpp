@@ -1,56 +1,49 @@
 #include "QmlStreamHandle.hpp"
 #include "StreamHandle.hpp"
+#include "QmlStream.hpp"
 #include <QVariant>
 #include <QString>
 
 quickstreams::qml::QmlStreamHandle::QmlStreamHandle() :
-	_handle(nullptr),
-	_adoptCb(nullptr),
-	_refGet(nullptr)
+	_engine(nullptr)
 {}
 
-
 quickstreams::qml::QmlStreamHandle::QmlStreamHandle(
-	quickstreams::StreamHandle* handle,
-	AdoptCallback adoptCb,
-	ReferenceGetter refGet
+	const quickstreams::StreamHandle& handle,
+	QQmlEngine* engine
 ) :
 	_handle(handle),
-	_adoptCb(adoptCb),
-	_refGet(refGet)
+	_engine(engine)
 {}
 
-quickstreams::qml::QmlStream*
-quickstreams::qml::QmlStreamHandle::reference() const {
-	return _refGet();
-}
-
 void quickstreams::qml::QmlStreamHandle::event(
 	const QVariant& name,
 	const QVariant& data
 ) const {
 	if(!name.canConvert<QString>()) return;
-	_handle->_eventCb(name.toString(), data);
+	_handle.event(name.toString(), data);
 }
 
 void quickstreams::qml::QmlStreamHandle::close(const QVariant& data) const {
-	_handle->_closeCb(data);
+	_handle.close(data);
 }
 
 void quickstreams::qml::QmlStreamHandle::fail(const QVariant& data) const {
-	_handle->_failCb(data);
+	_handle.fail(data);
 }
 
 quickstreams::qml::QmlStream* quickstreams::qml::QmlStreamHandle::adopt(
 	QmlStream* stream
 ) const {
-	return _adoptCb(stream);
+	auto target(_handle.stream());
+	if(target == nullptr) return stream;
+	return QmlStream::adopt(_engine, target, stream);
 }
 
 bool quickstreams::qml::QmlStreamHandle::isAbortable() const {
-	return _handle->_isAbortableCb();
+	return _handle.isAbortable();
 }
 
 bool quickstreams::qml::QmlStreamHandle::isAborted() const {
-	return _handle->_isAbortedCb();
+	return _handle.isAborted();
 }
@@ -2,6 +2,7 @@
 
 #include "StreamHandle.hpp"
 #include <QObject>
+#include <QQmlEngine>
 #include <QString>
 #include <QVariant>
 #include <QSharedPointer>
@@ -10,28 +11,26 @@ namespace quickstreams {
 namespace qml {
 
 class QmlStream;
+class JsExecutable;
 
 class QmlStreamHandle {
 	friend class QmlStream;
+	friend class JsExecutable;
 	Q_GADGET
 	Q_PROPERTY(bool isAbortable READ isAbortable)
 	Q_PROPERTY(bool isAborted READ isAborted)
 
-public:
-	typedef std::function<QmlStream*(QmlStream*)> AdoptCallback;
-	typedef std::function<QmlStream*()> ReferenceGetter;
-
 protected:
-	quickstreams::StreamHandle* _handle;
-	AdoptCallback _adoptCb;
-	ReferenceGetter _refGet;
+	quickstreams::StreamHandle _handle;
 
-	QmlStream* reference() const;
+	// The engine adopted streams are wrapped for. The stream is reached
+	// through the handle since its wrapper may be garbage collected
+	// while the stream is still running
+	QQmlEngine* _engine;
 
 	QmlStreamHandle(
-		quickstreams::StreamHandle* handle,
-		AdoptCallback adoptCb,
-		ReferenceGetter refGet
+		const quickstreams::StreamHandle& handle,
+		QQmlEngine* engine
 	);
 
 public:
@@ -7,6 +7,8 @@ quickstreams::Retryer::Retryer(qint32 maxTrials) :
 	_currentTrial(0)
 {}
 
+quickstreams::Retryer::~Retryer() {}
+
 void quickstreams::Retryer::Retryer::reset() {
 	_currentTrial = 0;
 }
@@ -26,3 +28,7 @@ bool quickstreams::Retryer::verify(const QVariant& error) {
 	}
 	return false;
 }
+
+qint32 quickstreams::Retryer::backoff() {
+	return 0;
+}
@@ -16,12 +16,17 @@ protected:
 
 public:
 	Retryer(qint32 maxTrials);
-	void reset();
+	virtual ~Retryer();
+	virtual void reset();
 	bool isInfinite() const;
 	bool isMaxReached() const;
 	bool verify(const QVariant& error);
 
 	virtual bool verifyCondition(const QVariant& error) = 0;
+
+	// Returns the number of milliseconds to back off for
+	// before the verified retrial, 0 retries right away
+	virtual qint32 backoff();
 };
 
 } // quickstreams
@@ -0,0 +1,15 @@
+#include "Scheduler.hpp"
+#include "SharedQueueScheduler.hpp"
+#include "WorkStealingScheduler.hpp"
+
+quickstreams::Scheduler::Reference quickstreams::Scheduler::create(
+	Policy policy,
+	int workers
+) {
+	switch(policy) {
+	case Policy::WorkStealing:
+		return Reference(new WorkStealingScheduler(workers));
+	default:
+		return Reference(new SharedQueueScheduler(workers));
+	}
+}
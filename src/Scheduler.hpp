@@ -0,0 +1,58 @@
+#pragma once
+
+#include <functional>
+#include <QThread>
+#include <QSharedPointer>
+
+namespace quickstreams {
+
+// The scheduler executes the executables of offloaded streams
+// on worker threads. Tasks must never touch the stream bookkeeping directly,
+// results are posted back to the provider thread.
+class Scheduler {
+public:
+	typedef QSharedPointer<Scheduler> Reference;
+	typedef std::function<void()> Task;
+
+	enum class Policy : char {
+		// All workers take tasks from a single shared queue
+		SharedQueue,
+
+		// Every worker owns a queue and steals tasks
+		// from the queues of other workers when its own is empty
+		WorkStealing
+	};
+
+	struct Statistics {
+		// Number of executed tasks, counted when the execution starts
+		quint64 executed;
+
+		// Number of tasks taken from the own queue of a worker
+		quint64 localPops;
+
+		// Number of tasks stolen from the queue of another worker
+		quint64 steals;
+
+		// Total time in nanoseconds the workers spent waiting for tasks
+		quint64 idleTime;
+	};
+
+	virtual ~Scheduler() {}
+
+	// Creates a scheduler implementing the given policy
+	static Reference create(
+		Policy policy,
+		int workers = QThread::idealThreadCount()
+	);
+
+	// Schedules the task for execution on any of the worker threads.
+	// Thread-safe
+	virtual void post(const Task& task) = 0;
+
+	// Returns the number of worker threads
+	virtual int workers() const = 0;
+
+	virtual Statistics statistics() const = 0;
+};
+
+} // quickstreams
@@ -0,0 +1,192 @@
+#include "SequenceTemplate.hpp"
+#include "Stream.hpp"
+#include "Executable.hpp"
+#include "LambdaSyncExecutable.hpp"
+#include "TypeRetryer.hpp"
+#include "LambdaRetryer.hpp"
+#include "LambdaRepeater.hpp"
+#include <exception>
+
+quickstreams::SequenceTemplate::SequenceTemplate() {}
+
+quickstreams::SequenceTemplate::ExecutableFactory
+quickstreams::SequenceTemplate::syncFactory(
+	LambdaSyncExecutable::Function function
+) {
+	return [function]() {
+		return Executable::Reference(new LambdaSyncExecutable(function));
+	};
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::append(
+	Link link,
+	const ExecutableFactory& executable
+) {
+	_steps.append(Step{link, executable, nullptr, nullptr, -1});
+	return *this;
+}
+
+quickstreams::SequenceTemplate::Step&
+quickstreams::SequenceTemplate::lastStep() {
+	if(_steps.isEmpty()) throw std::logic_error(
+		"QuickStreams - FATAL ERROR: "
+		"Attempted to use a stream operator on an empty sequence template!"
+	);
+	return _steps.last();
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::attach(
+	const ExecutableFactory& executable
+) {
+	return append(Link::Attach, executable);
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::attach(
+	LambdaSyncExecutable::Function function
+) {
+	return append(Link::Attach, syncFactory(function));
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::bind(
+	const ExecutableFactory& executable
+) {
+	return append(Link::Bind, executable);
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::bind(
+	LambdaSyncExecutable::Function function
+) {
+	return append(Link::Bind, syncFactory(function));
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::delay(
+	qint32 duration
+) {
+	lastStep().delay = duration;
+	return *this;
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::retry(
+	const RetryerFactory& retryer
+) {
+	lastStep().retryer = retryer;
+	return *this;
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::retry(
+	const TypeRetryer::TypeList& errorTypes,
+	qint32 maxTrials
+) {
+	return retry([errorTypes, maxTrials]() {
+		return Retryer::Reference(new TypeRetryer(errorTypes, maxTrials));
+	});
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::retry(
+	LambdaRetryer::Function function,
+	qint32 maxTrials
+) {
+	return retry([function, maxTrials]() {
+		return Retryer::Reference(new LambdaRetryer(function, maxTrials));
+	});
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::repeat(
+	LambdaRepeater::Function function
+) {
+	lastStep().repeater = [function]() {
+		return Repeater::Reference(new LambdaRepeater(function));
+	};
+	return *this;
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::failure(
+	const ExecutableFactory& executable
+) {
+	_failure = executable;
+	return *this;
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::failure(
+	LambdaSyncExecutable::Function function
+) {
+	return failure(syncFactory(function));
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::abortion(
+	const ExecutableFactory& executable
+) {
+	_abortion = executable;
+	return *this;
+}
+
+quickstreams::SequenceTemplate& quickstreams::SequenceTemplate::abortion(
+	LambdaSyncExecutable::Function function
+) {
+	return abortion(syncFactory(function));
+}
+
+quickstreams::Stream::Reference quickstreams::SequenceTemplate::instantiate(
+	const Stream::Reference& head
+) const {
+	// Verify the head only, the rest of the sequence is valid by construction
+	if(!_steps.isEmpty()) {
+		if(_steps.first().link == Link::Attach) head->verifyAttach();
+		else head->verifyBind();
+	}
+	if(_failure) head->verifyFailureSequence();
+	if(_abortion) head->verifyAbortionSequence();
+
+	Stream::Reference last(head);
+	for(
+		Steps::const_iterator itr(_steps.constBegin());
+		itr != _steps.constEnd();
+		itr++
+	) {
+		const auto& step(*itr);
+		Executable::Reference executable(nullptr);
+		if(step.executable) executable = step.executable();
+
+		Stream::Reference stream(nullptr);
+		if(step.link == Link::Attach) {
+			stream = last->create(
+				executable,
+				Stream::Type::Abortable,
+				Stream::CaptionStatus::Attached
+			);
+			last->_captured = Stream::Captured::Attached;
+		} else {
+			stream = last->create(
+				executable,
+				Stream::Type::Abortable,
+				Stream::CaptionStatus::Bound
+			);
+			last->_captured = Stream::Captured::Bound;
+		}
+		last->connectSubsequent(stream.data());
+
+		if(step.delay >= 0) stream->delay(step.delay);
+		if(step.retryer) stream->_retryer = step.retryer();
+		if(step.repeater) stream->_repeater = step.repeater();
+		last.swap(stream);
+	}
+
+	// Register the failure and abortion sequences once per instance
+	if(_failure) {
+		auto failureStream(head->create(
+			_failure(), Stream::Type::Atomic, Stream::CaptionStatus::Bound
+		));
+		last->registerFailureSequence(failureStream.data());
+	}
+	if(_abortion) {
+		auto abortionStream(head->create(
+			_abortion(), Stream::Type::Atomic, Stream::CaptionStatus::Bound
+		));
+		last->registerAbortionSequence(abortionStream.data());
+	}
+	return last;
+}
+
+int quickstreams::SequenceTemplate::size() const {
+	return _steps.size();
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Stream.hpp"
+#include "Executable.hpp"
+#include "LambdaSyncExecutable.hpp"
+#include "Retryer.hpp"
+#include "TypeRetryer.hpp"
+#include "LambdaRetryer.hpp"
+#include "Repeater.hpp"
+#include "LambdaRepeater.hpp"
+#include <functional>
+#include <QVector>
+
+namespace quickstreams {
+
+// The sequence template declares the topology of a stream sequence once
+// and instantiates it on top of any head stream many times. The template
+// is linear by construction, thus the operators are verified
+// only once per instantiation on the head stream, all other streams
+// are linked internally without verification.
+//
+// Executables, retryers and repeaters carry per-instance state
+// and are thus created by factories for each instance.
+class SequenceTemplate {
+public:
+	typedef std::function<Executable::Reference()> ExecutableFactory;
+	typedef std::function<Retryer::Reference()> RetryerFactory;
+	typedef std::function<Repeater::Reference()> RepeaterFactory;
+
+protected:
+	enum class Link : char {Attach, Bind};
+
+	struct Step {
+		Link link;
+		ExecutableFactory executable;
+		RetryerFactory retryer;
+		RepeaterFactory repeater;
+		qint32 delay;
+	};
+	typedef QVector<Step> Steps;
+
+	Steps _steps;
+	ExecutableFactory _failure;
+	ExecutableFactory _abortion;
+
+	static ExecutableFactory syncFactory(
+		LambdaSyncExecutable::Function function
+	);
+
+	SequenceTemplate& append(Link link, const ExecutableFactory& executable);
+
+	// Returns the last declared step, throws an exception
+	// if a stream operator is used before any stream was declared
+	Step& lastStep();
+
+public:
+	SequenceTemplate();
+
+	// Declares a stream attached to the previous one
+	SequenceTemplate& attach(const ExecutableFactory& executable);
+	SequenceTemplate& attach(LambdaSyncExecutable::Function function);
+
+	// Declares a stream bound to the previous one
+	SequenceTemplate& bind(const ExecutableFactory& executable);
+	SequenceTemplate& bind(LambdaSyncExecutable::Function function);
+
+	// Stream operators applied to the last declared stream
+	SequenceTemplate& delay(qint32 duration);
+	SequenceTemplate& retry(const RetryerFactory& retryer);
+	SequenceTemplate& retry(
+		const TypeRetryer::TypeList& errorTypes,
+		qint32 maxTrials = -1
+	);
+	SequenceTemplate& retry(
+		LambdaRetryer::Function function,
+		qint32 maxTrials = -1
+	);
+	SequenceTemplate& repeat(LambdaRepeater::Function function);
+
+	// Chain operators applied to the entire instantiated sequence
+	// including the head stream and the sequence it belongs to
+	SequenceTemplate& failure(const ExecutableFactory& executable);
+	SequenceTemplate& failure(LambdaSyncExecutable::Function function);
+	SequenceTemplate& abortion(const ExecutableFactory& executable);
+	SequenceTemplate& abortion(LambdaSyncExecutable::Function function);
+
+	// Instantiates the declared sequence on top of the given head stream
+	// and returns the last stream of the instance
+	Stream::Reference instantiate(const Stream::Reference& head) const;
+
+	// Returns the number of streams created per instance,
+	// not including the failure and abortion streams
+	int size() const;
+};
+
+} // quickstreams
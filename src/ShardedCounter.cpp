@@ -0,0 +1,54 @@
+#include "ShardedCounter.hpp"
+#include <cstddef>
+#include <memory>
+#include <new>
+
+quickstreams::ShardedCounter::Shard::Shard() :
+	value(0)
+{}
+
+int quickstreams::ShardedCounter::shard() {
+	// Threads are assigned to shards round robin
+	static QAtomicInteger<quint32> next(0);
+	static thread_local int index(
+		int(next.fetchAndAddRelaxed(1) % quint32(Shards))
+	);
+	return index;
+}
+
+quickstreams::ShardedCounter::ShardedCounter() :
+	_block(::operator new(sizeof(Shard) * Shards + CacheLineSize - 1)),
+	_shards(nullptr)
+{
+	// Start the shards at the first cache line boundary of the block
+	std::size_t space(sizeof(Shard) * Shards + CacheLineSize - 1);
+	void* aligned(_block);
+	std::align(CacheLineSize, sizeof(Shard) * Shards, aligned, space);
+	_shards = static_cast<Shard*>(aligned);
+	for(int itr(0); itr < Shards; ++itr) new (&_shards[itr]) Shard();
+}
+
+quickstreams::ShardedCounter::~ShardedCounter() {
+	for(int itr(0); itr < Shards; ++itr) _shards[itr].~Shard();
+	::operator delete(_block);
+}
+
+void quickstreams::ShardedCounter::add(qint64 delta) {
+	_shards[shard()].value.fetchAndAddRelaxed(delta);
+}
+
+void quickstreams::ShardedCounter::increment() {
+	add(1);
+}
+
+void quickstreams::ShardedCounter::decrement() {
+	add(-1);
+}
+
+quint64 quickstreams::ShardedCounter::load() const {
+	qint64 sum(0);
+	for(int itr(0); itr < Shards; ++itr) {
+		sum += _shards[itr].value.load();
+	}
+	return sum < 0 ? 0 : quint64(sum);
+}
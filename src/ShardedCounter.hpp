@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QAtomicInteger>
+
+namespace quickstreams {
+
+// The sharded counter is a thread-safe counter spreading its updates
+// over a number of atomic shards each padded to its own cache line.
+// Each thread updates the shard it was assigned to on its first update
+// so concurrent updates from different threads don't contend for
+// the same cache line. The value is aggregated when it's read.
+class ShardedCounter {
+public:
+	static const int Shards = 16;
+	static const int CacheLineSize = 64;
+
+protected:
+	// Shards hold signed deltas since a value may be incremented
+	// on one thread and decremented on another
+	struct alignas(CacheLineSize) Shard {
+		QAtomicInteger<qint64> value;
+
+		Shard();
+	};
+
+	// The shards are allocated separately and aligned manually
+	// because heap allocations of over-aligned types aren't aligned
+	// before C++17, the counter itself remains embeddable anywhere
+	void* _block;
+	Shard* _shards;
+
+	// Returns the index of the shard assigned to the current thread
+	static int shard();
+
+public:
+	ShardedCounter();
+	~ShardedCounter();
+
+	ShardedCounter(const ShardedCounter&) = delete;
+	ShardedCounter& operator=(const ShardedCounter&) = delete;
+
+	void add(qint64 delta);
+	void increment();
+	void decrement();
+
+	// Returns the sum of all shards. Concurrent updates may or may not
+	// be included but the value is exact once all updates are done
+	quint64 load() const;
+};
+
+} // quickstreams
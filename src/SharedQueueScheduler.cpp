@@ -0,0 +1,79 @@
+#include "SharedQueueScheduler.hpp"
+#include <QThread>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+
+quickstreams::SharedQueueScheduler::Worker::Worker(
+	SharedQueueScheduler* scheduler
+) :
+	QThread(nullptr),
+	_scheduler(scheduler)
+{}
+
+void quickstreams::SharedQueueScheduler::Worker::run() {
+	Task task;
+	while(_scheduler->take(task)) {
+		_scheduler->_executed.fetchAndAddRelaxed(1);
+		task();
+		task = nullptr;
+	}
+}
+
+quickstreams::SharedQueueScheduler::SharedQueueScheduler(int workers) :
+	_stopping(false),
+	_executed(0),
+	_idleTime(0)
+{
+	if(workers < 1) workers = 1;
+	for(int itr(0); itr < workers; ++itr) {
+		auto worker(new Worker(this));
+		_workers.append(worker);
+		worker->start();
+	}
+}
+
+quickstreams::SharedQueueScheduler::~SharedQueueScheduler() {
+	{
+		QMutexLocker lock(&_lock);
+		_stopping = true;
+		_available.wakeAll();
+	}
+	for(
+		Workers::const_iterator itr(_workers.constBegin());
+		itr != _workers.constEnd();
+		itr++
+	) {
+		(*itr)->wait();
+		delete *itr;
+	}
+}
+
+bool quickstreams::SharedQueueScheduler::take(Task& task) {
+	QMutexLocker lock(&_lock);
+	while(_tasks.isEmpty()) {
+		if(_stopping) return false;
+		QElapsedTimer idle;
+		idle.start();
+		_available.wait(&_lock);
+		_idleTime.fetchAndAddRelaxed(quint64(idle.nsecsElapsed()));
+	}
+	task = _tasks.dequeue();
+	return true;
+}
+
+void quickstreams::SharedQueueScheduler::post(const Task& task) {
+	QMutexLocker lock(&_lock);
+	_tasks.enqueue(task);
+	_available.wakeOne();
+}
+
+int quickstreams::SharedQueueScheduler::workers() const {
+	return _workers.size();
+}
+
+quickstreams::Scheduler::Statistics
+quickstreams::SharedQueueScheduler::statistics() const {
+	return Statistics{_executed.load(), 0, 0, _idleTime.load()};
+}
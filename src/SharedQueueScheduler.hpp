@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Scheduler.hpp"
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QQueue>
+#include <QVector>
+#include <QAtomicInteger>
+
+namespace quickstreams {
+
+// The shared queue scheduler distributes tasks to its worker threads
+// through a single, lock protected queue. Tasks still queued when the
+// scheduler is destroyed are executed before the workers are stopped.
+class SharedQueueScheduler : public Scheduler {
+protected:
+	class Worker : public QThread {
+	protected:
+		SharedQueueScheduler* _scheduler;
+		void run();
+
+	public:
+		explicit Worker(SharedQueueScheduler* scheduler);
+	};
+
+	typedef QQueue<Task> TaskQueue;
+	typedef QVector<Worker*> Workers;
+
+	QMutex _lock;
+	QWaitCondition _available;
+	TaskQueue _tasks;
+	bool _stopping;
+	Workers _workers;
+	QAtomicInteger<quint64> _executed;
+	QAtomicInteger<quint64> _idleTime;
+
+	// Blocks until a task is available and returns true,
+	// returns false if the scheduler is stopping and no tasks are left
+	bool take(Task& task);
+
+public:
+	explicit SharedQueueScheduler(int workers = QThread::idealThreadCount());
+	~SharedQueueScheduler();
+
+	void post(const Task& task);
+	int workers() const;
+	Statistics statistics() const;
+};
+
+} // quickstreams
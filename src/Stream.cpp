@@ -8,16 +8,72 @@
 #include "LambdaRepeater.hpp"
 #include "TypeRetryer.hpp"
 #include "LambdaRetryer.hpp"
+#include "BackoffRetryer.hpp"
+#include "Transition.hpp"
+#include "StreamPool.hpp"
+#include "TimerWheel.hpp"
+#include "Error.hpp"
+#include "QmlStream.hpp"
+#include <cstddef>
+#include <utility>
+#include <new>
 #include <exception>
 #include <QJSValue>
 #include <QList>
 #include <QString>
 #include <QVariant>
 #include <QMetaObject>
-#include <QTimer>
+#include <QMetaMethod>
 #include <QSharedPointer>
 #include <QDebug>
 
+// Every stream allocation is prefixed with a header
+// storing the pool the stream was allocated in, or null if it was allocated
+// on the heap. The header is padded to keep the stream properly aligned
+static const std::size_t AllocationHeaderSize(
+	(sizeof(quickstreams::StreamPool*) + alignof(std::max_align_t) - 1)
+	/ alignof(std::max_align_t) * alignof(std::max_align_t)
+);
+
+const std::size_t quickstreams::Stream::AllocationSize(
+	AllocationHeaderSize + sizeof(quickstreams::Stream)
+);
+
+void* quickstreams::Stream::operator new(std::size_t size) {
+	return Stream::operator new(size, nullptr);
+}
+
+void* quickstreams::Stream::operator new(
+	std::size_t size,
+	StreamPool* pool
+) {
+	void* block(nullptr);
+	if(pool != nullptr) {
+		block = pool->acquire(AllocationHeaderSize + size);
+	} else {
+		block = ::operator new(AllocationHeaderSize + size);
+	}
+	*static_cast<StreamPool**>(block) = pool;
+	return static_cast<char*>(block) + AllocationHeaderSize;
+}
+
+void quickstreams::Stream::operator delete(void* pointer) {
+	if(pointer == nullptr) return;
+	void* block(static_cast<char*>(pointer) - AllocationHeaderSize);
+	auto pool(*static_cast<StreamPool**>(block));
+	if(pool != nullptr) {
+		pool->release(block);
+	} else {
+		::operator delete(block);
+	}
+}
+
+void quickstreams::Stream::operator delete(void* pointer, StreamPool*) {
+	// Invoked only if the constructor threw,
+	// the allocation header already knows the origin of the memory
+	Stream::operator delete(pointer);
+}
+
 quickstreams::Executable::Reference quickstreams::Stream::Wrap(
 	quickstreams::LambdaWrapper::Function function
 ) {
@@ -34,56 +90,66 @@ quickstreams::Stream::Stream(
 	_provider(provider),
 	_type(type),
 	_state(State::Initializing),
+	_aborted(0),
 	_captured(Captured::None),
 	_captionStatus(captionStatus),
 	_parent(nullptr),
-	_failure(nullptr),
-	_abortion(nullptr),
-	_handle(
-		// Called when stream is requested to emit an event
-		[this](const QString& name, const QVariant& data) {
-			emitEvent(name, data);
-		},
-		// Called when stream is requested to close
-		[this](const QVariant& data) {
-			emitClosed(data);
-		},
-		// Called when stream is requested to fail
-		[this](const QVariant& reason) {
-			emitFailed(reason, WakeCondition::Default);
-		},
-		// Called when stream is requested to adopt another stream
-		[this](Reference& reference) {
-			return adopt(reference);
-		},
-		// Called when isAbortable is requested
-		[this]() {
-			return isAbortable();
-		},
-		// Called when isAborted is requested
-		[this]() {
-			return isAborted();
-		}
-	),
+	_previous(nullptr),
+	_next(nullptr),
+	_sequence(nullptr),
+	_wrapper(nullptr),
+	_qmlStream(nullptr),
 	_executable(executable),
-	_awakeningTimer(nullptr),
+	_delay(-1),
+	_delayedWakeCondition(WakeCondition::DefaultNoDelay),
 	_retryer(nullptr),
-	_repeater(nullptr)
+	_repeater(nullptr),
+	_offloaded(false),
+	_executing(false),
+	_awakeDeferred(false),
+	_deferredWakeCondition(WakeCondition::Default),
+	_trial(0),
+	_timeout(-1),
+	_permit()
 {
-	if(!_executable.isNull()) _executable->setHandle(&_handle);
-	connect(
-		this, &Stream::retryIteration,
-		this, &Stream::awake,
-		Qt::QueuedConnection
-	);
-	connect(
-		this, &Stream::repeatIteration,
-		this, &Stream::awake,
-		Qt::QueuedConnection
-	);
+	quint32 slot(0);
+	quint32 generation(0);
+	_provider->acquireSlot(this, slot, generation);
+	_handle = StreamHandle(_provider, slot, generation);
+
+	if(!_executable.isNull()) {
+		_executable->setHandle(&_handle);
+		_executable->setTranslator(_provider->exceptionTranslator());
+	}
+	_timeoutTimer.setCallback([this]() {
+		expire();
+	});
+	_delayTimer.setCallback([this]() {
+		QVariant data;
+		data.swap(_delayedData);
+		awake(std::move(data), _delayedWakeCondition);
+	});
 }
 
 quickstreams::Stream::~Stream() {
+	// Invalidate all handles referring to this stream
+	_provider->releaseSlot(_handle._slot);
+
+	unwrap();
+
+	// Unlink this stream from its superordinate, subordinate,
+	// preceding and subsequent streams to avoid dangling pointers
+	if(_parent) _parent->_subordinates.removeOne(this);
+	for(
+		Subordinates::const_iterator itr(_subordinates.constBegin());
+		itr != _subordinates.constEnd();
+		itr++
+	) {
+		(*itr)->_parent = nullptr;
+	}
+	if(_previous) _previous->_next = nullptr;
+	if(_next) _next->_previous = nullptr;
+
 	_provider->destroyed();
 }
 
@@ -92,7 +158,7 @@ quickstreams::Stream::Reference quickstreams::Stream::create(
 	Type type,
 	CaptionStatus captionStatus
 ) const {
-	Stream::Reference reference(new Stream(
+	Stream::Reference reference(new (_provider->pool()) Stream(
 		_provider, executable, type, captionStatus
 	), &Stream::deleteLater);
 	_provider->registerNew(reference);
@@ -161,6 +227,25 @@ void quickstreams::Stream::verifyBindStream(const Reference& stream) const {
 	);
 }
 
+void quickstreams::Stream::verifyCombinable() const {
+	// Only free streams that are not yet running can be launched
+	// by combinators and maps
+	if(
+		_state != State::Initializing
+		|| _captionStatus != CaptionStatus::Free
+	) throw std::logic_error(
+		"QuickStreams - FATAL ERROR: "
+		"Attempted to combine a non-free stream!"
+	);
+
+	// Combinators observe the settlement of the stream itself,
+	// the rest of a captured sequence would run unobserved
+	if(_captured != Captured::None) throw std::logic_error(
+		"QuickStreams - FATAL ERROR: "
+		"Attempted to combine a stream capturing another one!"
+	);
+}
+
 void quickstreams::Stream::verifyFailureSequence() const {
 	// Failure operator cannot be used past the initialization phase
 	if(_state != State::Initializing) throw std::logic_error(
@@ -216,7 +301,10 @@ void quickstreams::Stream::verifyAbortionSequenceStream(Stream* stream) const {
 void quickstreams::Stream::verifyFailSeqStreamNotMember(
 	Stream* stream
 ) const {
-	if(this == stream) throw std::logic_error(
+	if(
+		this == stream
+		|| (!stream->_sequence.isNull() && stream->sequence() == sequence())
+	) throw std::logic_error(
 		"QuickStreams - FATAL ERROR: "
 		"Registered a sequence member stream as the initial stream "
 		"of a failure recovery sequence branching off it!"
@@ -226,7 +314,10 @@ void quickstreams::Stream::verifyFailSeqStreamNotMember(
 void quickstreams::Stream::verifyAbortSeqStreamNotMember(
 	Stream* stream
 ) const {
-	if(this == stream) throw std::logic_error(
+	if(
+		this == stream
+		|| (!stream->_sequence.isNull() && stream->sequence() == sequence())
+	) throw std::logic_error(
 		"QuickStreams - FATAL ERROR: "
 		"Registered a sequence member stream as the initial stream "
 		"of an abortion recovery sequence branching off it!"
@@ -265,10 +356,16 @@ void quickstreams::Stream::emitEvent(
 	}
 }
 
-void quickstreams::Stream::emitClosed(const QVariant& data) {
+void quickstreams::Stream::emitClosed(QVariant data) {
 	// Dead and canceled streams can't be closed
 	if(isInactive()) return;
 
+	// The trial settled in time
+	_timeoutTimer.cancel();
+	releasePermit(isAborted() ?
+		CircuitBreaker::Outcome::Canceled : CircuitBreaker::Outcome::Success
+	);
+
 	// Reset trial counter on success
 	if(!_retryer.isNull()) _retryer->reset();
 
@@ -276,7 +373,8 @@ void quickstreams::Stream::emitClosed(const QVariant& data) {
 	if(!_repeater.isNull()) {
 		if(_repeater->evaluate(isAborted())) {
 			// Repeat asynchronously resurrecting this stream in another tick
-			repeatIteration(data, WakeCondition::Default);
+			nextTrial();
+			schedule(this, Transition::Kind::Awake, std::move(data));
 			return;
 		}
 	}
@@ -288,13 +386,13 @@ void quickstreams::Stream::emitClosed(const QVariant& data) {
 	if(isAborted()) {
 		switch(_captured) {
 		case Captured::Bound:
-			closed(data, WakeCondition::Abort);
+			dispatchClosed(std::move(data), WakeCondition::Abort);
 			// Die but don't touch any other sequence,
 			// forward cleanup responsibility to the bound stream.
 			die();
 			return;
 		default:
-			aborted(data, WakeCondition::Default);
+			dispatchAborted(data);
 			// Die and cancel unreachable sequences
 			// (current sequence and the failure sequence)
 			die();
@@ -305,7 +403,7 @@ void quickstreams::Stream::emitClosed(const QVariant& data) {
 	}
 
 	// Otherwise close this stream initializing the next stream
-	closed(data, WakeCondition::Default);
+	dispatchClosed(std::move(data), WakeCondition::Default);
 	die();
 
 	// If this stream represents the end of a sequence
@@ -323,18 +421,39 @@ void quickstreams::Stream::emitFailed(
 	// Dead and canceled stream can't fail
 	if(isInactive()) return;
 
+	// The trial settled in time
+	_timeoutTimer.cancel();
+	releasePermit(CircuitBreaker::Outcome::Failure);
+
 	// Check whether retrial is desired
 	if(!_retryer.isNull()) {
 		if(_retryer->verify(data)) {
-			// Retry asynchronously
-			retryIteration(data, wakeCondition);
+			nextTrial();
+
+			// Back off before retrying if the retryer requires it.
+			// An abortable stream aborted while backing off is never retried
+			qint32 backoff(_retryer->backoff());
+			if(backoff > 0) {
+				if(_state == State::Active) _state = State::AwaitingDelay;
+				_delayedData = data;
+				_delayedWakeCondition = wakeCondition == WakeCondition::Abort ?
+					WakeCondition::Abort : WakeCondition::Default;
+				_provider->timers()->schedule(&_delayTimer, backoff);
+				return;
+			}
+
+			// Otherwise retry asynchronously
+			schedule(this, wakeCondition == WakeCondition::Abort ?
+				Transition::Kind::AwakeAborted : Transition::Kind::Awake,
+				data
+			);
 			return;
 		}
 	}
 
 	// Otherwise fail this stream and redirect control flow
 	// to the failure recovery sequence
-	failed(data, WakeCondition::Default);
+	dispatchFailed(data);
 	// Die and cancel unreachable sequences
 	// (current sequence and the abortion sequence)
 	die();
@@ -343,76 +462,26 @@ void quickstreams::Stream::emitFailed(
 }
 
 void quickstreams::Stream::setSuperordinateStream(Stream *stream) {
-	// Remember parent stream for automatic inheritance
-	_parent = stream;
+	// Leave the previous parent stream if any
+	if(_parent) _parent->_subordinates.removeOne(this);
 
-	// Immediately react to parents abortion
-	connect(
-		_parent, &Stream::abortSubordinate,
-		this, &Stream::abort,
-		Qt::DirectConnection
-	);
-
-	// Immediately die on parents elimination command
-	connect(
-		_parent, &Stream::eliminateSubordinate,
-		this, &Stream::die,
-		Qt::DirectConnection
-	);
+	// Remember parent stream for automatic inheritance.
+	// The parent stream immediately aborts and eliminates
+	// its subordinate streams when it's aborted or dies
+	_parent = stream;
+	_parent->_subordinates.append(this);
 }
 
 void quickstreams::Stream::connectSubsequent(Stream* stream) {
-	// Receive failure and abortion sequence propagation signals
-	// during the declaration in both directions (up and down)
-	connect(
-		this, &Stream::propagateFailSeqUp,
-		stream, &Stream::onPropagateFailSeqUp,
-		Qt::DirectConnection
-	);
-	connect(
-		stream, &Stream::propagateFailSeqDown,
-		this, &Stream::onPropagateFailSeqDown,
-		Qt::DirectConnection
-	);
-
-	connect(
-		this, &Stream::propagateAbortSeqUp,
-		stream, &Stream::onPropagateAbortSeqUp,
-		Qt::DirectConnection
-	);
-	connect(
-		stream, &Stream::propagateAbortSeqDown,
-		this, &Stream::onPropagateAbortSeqDown,
-		Qt::DirectConnection
-	);
-
-	// Initialize the stream and the following sequence recursively
-	connect(
-		this, &Stream::initializeSequences,
-		stream, &Stream::onInitialize,
-		Qt::DirectConnection
-	);
-
-	// Immediately kill the subsequent stream including the entire sequence
-	connect(
-		this, &Stream::eliminateSequence,
-		stream, &Stream::onEliminateSequence,
-		Qt::DirectConnection
-	);
-
-	// When this stream closes - awake the next stream
-	connect(
-		this, &Stream::closed,
-		stream, &Stream::awake,
-		Qt::QueuedConnection
-	);
+	// Link the subsequent stream, it's awoken when this stream closes
+	_next = stream;
+	stream->_previous = this;
 
 	// Automatically inherit parent stream
 	if(_parent) stream->setSuperordinateStream(_parent);
 
 	// Automatically inherit failure and abortion sequences
-	if(_failure) stream->connectFailureSequence(_failure);
-	if(_abortion) stream->connectAbortionSequence(_abortion);
+	stream->joinSequence(this);
 }
 
 void quickstreams::Stream::die() {
@@ -420,6 +489,7 @@ void quickstreams::Stream::die() {
 	// Active, Aborted and streams awaiting their delay become Dead
 	switch(_state) {
 	case State::Dead:
+	case State::Canceled:
 		return;
 	case State::Initializing:
 	case State::Awaiting:
@@ -431,125 +501,301 @@ void quickstreams::Stream::die() {
 		_state = State::Dead;
 		break;
 	}
+	_aborted.storeRelease(0);
+
+	// Stop waiting for the wrapped stream, the delay and the timeout
+	unwrap();
+	_delayTimer.cancel();
+	_delayedData.clear();
+	_awakeDeferred = false;
+	_deferredData.clear();
+	_timeoutTimer.cancel();
+	releasePermit(CircuitBreaker::Outcome::Canceled);
 
 	_provider->dispose(this);
 
+	// Don't let the QML wrapper keep the dead stream alive
+	// until the wrapper is garbage collected
+	if(_qmlStream) _qmlStream->release();
+
 	// Eliminate all subordinate streams
 	eliminateSubordinate();
 }
 
-void quickstreams::Stream::initialize() {
-	if(_captionStatus != CaptionStatus::Free) return;
+void quickstreams::Stream::wrap(Stream* stream) {
+	unwrap();
 
-	// Transit all subsequent streams as well as the abortion
-	// and failure streams into the Awaiting state locking them
-	// to prevent further manipulation through operators at runtime
-	initializeSequences();
-	_state = State::Awaiting;
+	// A disposed stream will never close nor fail
+	if(stream->isDisposed()) return;
 
-	awake(QVariant(), WakeCondition::Default);
+	// Keep the wrapped stream alive for as long as this stream awaits it
+	stream->_wrapper = this;
+	_wrapped = _provider->reference(stream);
 }
 
-void quickstreams::Stream::registerFailureSequence(Stream* initialStream) {
-	verifyFailSeqStreamNotMember(initialStream);
-
-	// Disconnect and eliminate (override) the registered failure sequence
-	disconnect(this, &Stream::failed, 0, 0);
-	eliminateFailureSequence();
+void quickstreams::Stream::unwrap() {
+	if(_wrapped.isNull()) return;
+	if(_wrapped->_wrapper == this) _wrapped->_wrapper = nullptr;
+	_wrapped.clear();
+}
 
-	connectFailureSequence(initialStream);
+void quickstreams::Stream::schedule(
+	Stream* target,
+	Transition::Kind kind,
+	QVariant data
+) {
+	// Canceled and dead streams are unreachable
+	if(target->isDisposed()) return;
+	_provider->schedule(Transition{
+		_provider->reference(target), kind, std::move(data)
+	});
 }
 
-void quickstreams::Stream::connectFailureSequence(Stream* initialStream) {
-	_failure = initialStream;
+void quickstreams::Stream::dispatch(Transition& transition) {
+	switch(transition.kind) {
+	case Transition::Kind::Initialize:
+		// Streams eliminated after the transition was scheduled
+		// must not be awoken anymore
+		if(isDisposed()) return;
+		initialize();
+		break;
+	case Transition::Kind::Awake:
+		if(isDisposed()) return;
+		awake(std::move(transition.data), WakeCondition::Default);
+		break;
+	case Transition::Kind::AwakeAborted:
+		if(isDisposed()) return;
+		awake(std::move(transition.data), WakeCondition::Abort);
+		break;
+	case Transition::Kind::Close:
+		emitClosed(std::move(transition.data));
+		break;
+	case Transition::Kind::Fail:
+		emitFailed(transition.data, WakeCondition::Default);
+		break;
+	}
+}
 
-	// Initialize the failure sequence and the following sequence recursively
-	connect(
-		this, &Stream::initializeSequences,
-		initialStream, &Stream::onInitialize,
-		Qt::DirectConnection
+void quickstreams::Stream::dispatchClosed(
+	QVariant data,
+	WakeCondition wakeCondition
+) {
+	// The data is copied for all but the last of its consumers
+	// which takes it over. Signal arguments are passed by value
+	// so the signal is only emitted when it's observed
+	static const QMetaMethod closedSignal(
+		QMetaMethod::fromSignal(&Stream::closed)
 	);
+	const bool observed(isSignalConnected(closedSignal));
 
-	// Asynchronously awake failure recovery sequence
-	// if this stream fails
-	connect(
-		this, &Stream::failed,
-		initialStream, &Stream::awake,
-		Qt::QueuedConnection
-	);
+	// Awake the next stream
+	if(_next) {
+		const Transition::Kind kind(wakeCondition == WakeCondition::Abort ?
+			Transition::Kind::AwakeAborted : Transition::Kind::Awake
+		);
+		if(_wrapper || observed) schedule(_next, kind, data);
+		else schedule(_next, kind, std::move(data));
+	}
 
-	// Immediately kill the failure sequence on signal
-	connect(
-		this, &Stream::eliminateFailureSequence,
-		initialStream, &Stream::onEliminateSequence,
-		Qt::DirectConnection
-	);
+	// Close the stream wrapping this stream
+	if(_wrapper) {
+		if(observed) schedule(_wrapper, Transition::Kind::Close, data);
+		else schedule(_wrapper, Transition::Kind::Close, std::move(data));
+	}
+
+	if(observed) closed(std::move(data), wakeCondition);
 }
 
-void quickstreams::Stream::registerAbortionSequence(Stream* initialStream) {
-	verifyAbortSeqStreamNotMember(initialStream);
+void quickstreams::Stream::dispatchFailed(const QVariant& reason) {
+	// Awake the failure recovery sequence
+	auto failure(failureStream());
+	if(failure) schedule(failure, Transition::Kind::Awake, reason);
 
-	// Disconnect and eliminate (override) the registered abortion sequence
-	disconnect(this, &Stream::aborted, 0, 0);
-	eliminateAbortionSequence();
+	// Fail the stream wrapping this stream
+	if(_wrapper) schedule(_wrapper, Transition::Kind::Fail, reason);
 
-	connectAbortionSequence(initialStream);
+	failed(reason, WakeCondition::Default);
 }
 
-void quickstreams::Stream::connectAbortionSequence(Stream* initialStream) {
-	_abortion = initialStream;
+void quickstreams::Stream::dispatchAborted(const QVariant& reason) {
+	// Awake the abortion recovery sequence
+	auto abortion(abortionStream());
+	if(abortion) schedule(abortion, Transition::Kind::Awake, reason);
 
-	// Initialize the abortion sequence and the following sequence recursively
-	connect(
-		this, &Stream::initializeSequences,
-		initialStream, &Stream::onInitialize,
-		Qt::DirectConnection
-	);
+	aborted(reason, WakeCondition::Default);
+}
 
-	// Asynchronously awake abortion recovery sequence
-	// if this stream is aborted
-	connect(
-		this, &Stream::aborted,
-		initialStream, &Stream::awake,
-		Qt::QueuedConnection
-	);
+void quickstreams::Stream::initializeSequences() {
+	for(Stream* stream(_next); stream != nullptr; stream = stream->_next) {
+		stream->_state = State::Awaiting;
+	}
 
-	// Immediately kill the abortion sequence on signal
-	connect(
-		this, &Stream::eliminateAbortionSequence,
-		initialStream, &Stream::onEliminateSequence,
-		Qt::DirectConnection
-	);
+	// Failure and abortion sequences are shared by all members
+	// of a sequence and must only be initialized once
+	auto failure(failureStream());
+	if(failure && failure->_state == State::Initializing) {
+		failure->onInitialize();
+	}
+	auto abortion(abortionStream());
+	if(abortion && abortion->_state == State::Initializing) {
+		abortion->onInitialize();
+	}
+}
+
+void quickstreams::Stream::eliminate() {
+	die();
+	eliminateSequence();
+}
+
+void quickstreams::Stream::eliminateSequence() {
+	for(Stream* stream(_next); stream != nullptr; stream = stream->_next) {
+		stream->die();
+	}
+}
+
+void quickstreams::Stream::eliminateFailureSequence() {
+	auto failure(failureStream());
+	if(failure) failure->eliminate();
+}
+
+void quickstreams::Stream::eliminateAbortionSequence() {
+	auto abortion(abortionStream());
+	if(abortion) abortion->eliminate();
+}
+
+void quickstreams::Stream::abortSubordinate() {
+	// Iterate over a copy because subordinate streams
+	// may adopt or leave during the iteration
+	const Subordinates subordinates(_subordinates);
+	for(
+		Subordinates::const_iterator itr(subordinates.constBegin());
+		itr != subordinates.constEnd();
+		itr++
+	) {
+		(*itr)->abort();
+	}
+}
+
+void quickstreams::Stream::eliminateSubordinate() {
+	const Subordinates subordinates(_subordinates);
+	for(
+		Subordinates::const_iterator itr(subordinates.constBegin());
+		itr != subordinates.constEnd();
+		itr++
+	) {
+		(*itr)->die();
+	}
+}
+
+void quickstreams::Stream::initialize() {
+	if(_captionStatus != CaptionStatus::Free) return;
+	launch(QVariant());
+}
+
+void quickstreams::Stream::launch(const QVariant& data) {
+	// Transit all subsequent streams as well as the abortion
+	// and failure streams into the Awaiting state locking them
+	// to prevent further manipulation through operators at runtime
+	initializeSequences();
+	_state = State::Awaiting;
+
+	awake(data, WakeCondition::Default);
 }
 
-void quickstreams::Stream::onPropagateFailSeqUp(Stream* initialStream) {
-	registerFailureSequence(initialStream);
-	propagateFailSeqUp(initialStream);
+quickstreams::Stream::Sequence* quickstreams::Stream::sequence() const {
+	if(_sequence.isNull()) {
+		_sequence.reset(new Sequence{nullptr, nullptr, SequenceReference()});
+	}
+	while(!_sequence->forward.isNull()) {
+		SequenceReference forward(_sequence->forward);
+		_sequence.swap(forward);
+	}
+	return _sequence.data();
 }
 
-void quickstreams::Stream::onPropagateFailSeqDown(Stream* initialStream) {
-	registerFailureSequence(initialStream);
-	propagateFailSeqDown(initialStream);
+void quickstreams::Stream::joinSequence(Stream* predecessor) {
+	auto joined(predecessor->sequence());
+	if(_sequence.isNull()) {
+		_sequence = predecessor->_sequence;
+		return;
+	}
+
+	auto own(sequence());
+	if(own == joined) return;
+
+	// Inherit the failure and abortion sequences of the predecessor
+	// eliminating the overridden ones of the own sequence
+	if(own->failure) {
+		if(!joined->failure) joined->failure = own->failure;
+		else if(joined->failure != own->failure) own->failure->eliminate();
+	}
+	if(own->abortion) {
+		if(!joined->abortion) joined->abortion = own->abortion;
+		else if(joined->abortion != own->abortion) {
+			own->abortion->eliminate();
+		}
+	}
+
+	// Forward all other members of the own sequence to the joined one
+	own->failure = nullptr;
+	own->abortion = nullptr;
+	own->forward = predecessor->_sequence;
+	_sequence = predecessor->_sequence;
 }
 
-void quickstreams::Stream::onPropagateAbortSeqUp(Stream* initialStream) {
-	registerAbortionSequence(initialStream);
-	propagateAbortSeqUp(initialStream);
+quickstreams::Stream* quickstreams::Stream::failureStream() const {
+	if(_sequence.isNull()) return nullptr;
+	return sequence()->failure;
 }
 
-void quickstreams::Stream::onPropagateAbortSeqDown(Stream* initialStream) {
-	registerAbortionSequence(initialStream);
-	propagateAbortSeqDown(initialStream);
+quickstreams::Stream* quickstreams::Stream::abortionStream() const {
+	if(_sequence.isNull()) return nullptr;
+	return sequence()->abortion;
+}
+
+void quickstreams::Stream::registerFailureSequence(Stream* initialStream) {
+	verifyFailSeqStreamNotMember(initialStream);
+
+	// The failure sequence is initialized along with this sequence
+	// and asynchronously awoken if any of its members fails.
+	// Eliminate (override) the previously registered failure sequence
+	auto descriptor(sequence());
+	if(descriptor->failure && descriptor->failure != initialStream) {
+		descriptor->failure->eliminate();
+	}
+	descriptor->failure = initialStream;
+}
+
+void quickstreams::Stream::registerAbortionSequence(Stream* initialStream) {
+	verifyAbortSeqStreamNotMember(initialStream);
+
+	// The abortion sequence is initialized along with this sequence
+	// and asynchronously awoken if any of its members is aborted.
+	// Eliminate (override) the previously registered abortion sequence
+	auto descriptor(sequence());
+	if(descriptor->abortion && descriptor->abortion != initialStream) {
+		descriptor->abortion->eliminate();
+	}
+	descriptor->abortion = initialStream;
 }
 
 void quickstreams::Stream::awake(
 	QVariant data,
 	quickstreams::Stream::WakeCondition wakeCondition
 ) {
+	// Don't execute the offloaded executable again
+	// before its running execution was evaluated
+	if(_executing) {
+		_awakeDeferred = true;
+		_deferredData.swap(data);
+		_deferredWakeCondition = wakeCondition;
+		return;
+	}
+
 	// If the stream is supposed to delay its awakening then delay it
 	// but only if the wake condition allows it
 	if(
-		_awakeningTimer != nullptr
+		_delay >= 0
 		&& wakeCondition != WakeCondition::DefaultNoDelay
 		&& wakeCondition != WakeCondition::AbortNoDelay
 	) {
@@ -565,17 +811,10 @@ void quickstreams::Stream::awake(
 		default:
 			break;
 		}
-		QObject::disconnect(
-			_awakeningTimer, &QTimer::timeout,
-			nullptr, nullptr
-		);
-		QObject::connect(
-			_awakeningTimer, &QTimer::timeout,
-			this, [this, data, wakeCondition]() {
-				awake(data, wakeCondition);
-			}
-		);
-		_awakeningTimer->start();
+		// The delay timer is driven by the timer wheel of the provider
+		_delayedData.swap(data);
+		_delayedWakeCondition = wakeCondition;
+		_provider->timers()->schedule(&_delayTimer, _delay);
 		return;
 	}
 
@@ -585,18 +824,75 @@ void quickstreams::Stream::awake(
 		wakeCondition == WakeCondition::Abort
 		|| wakeCondition == WakeCondition::AbortNoDelay
 	)) {
-		_state = State::Aborted;
-	} else if(_state == State::Awaiting) {
+		setAborted();
+	} else if(
+		_state == State::Awaiting
+		|| _state == State::AwaitingDelay
+	) {
 		_state = State::Active;
 	}
 	_provider->activated();
 
+	// Fail fast without executing while the circuit breaker is open
+	if(!_breaker.isNull()) {
+		CircuitBreaker::Permit permit(_breaker->acquire());
+		if(permit.kind == CircuitBreaker::Permit::Kind::Rejected) {
+			// Rejections are frequent, the error is compact and
+			// shares the message and the name of the breaker
+			Error error(
+				exception::CircuitOpenError::type(),
+				_breaker->openMessage(), 0, _breaker->name()
+			);
+			emitFailed(
+				QVariant::fromValue<Error>(error),
+				isAborted() ? WakeCondition::Abort : WakeCondition::Default
+			);
+			return;
+		}
+		_permit = permit;
+	}
+
+	// Time box this trial
+	if(_timeout >= 0) _provider->timers()->schedule(&_timeoutTimer, _timeout);
+
 	// if function is not callable the stream is considered closed
 	if(_executable.isNull()) {
 		emitClosed(QVariant());
 		return;
 	};
+
+	// Execute offloaded executables on a worker thread and evaluate
+	// the results on the provider thread. The reference keeps this stream
+	// alive until the results are evaluated
+	const quint32 trial(_trial);
+	auto scheduler(_provider->scheduler());
+	if(_offloaded && scheduler != nullptr) {
+		// The worker uses a copy of the handle because the handle
+		// is renewed on the provider thread when the trial settles
+		Reference self(_provider->reference(this));
+		StreamHandle handle(_handle);
+		_executing = true;
+		scheduler->post([self, data, trial, handle]() mutable {
+			self->_executable->setHandle(&handle);
+			self->_executable->execute(data);
+			self->_provider->post([self, trial]() {
+				self->_executable->setHandle(&self->_handle);
+				self->_executing = false;
+				self->executed(trial);
+				self->resumeDeferred();
+			});
+		});
+		return;
+	}
+
 	_executable->execute(data);
+	executed(trial);
+}
+
+void quickstreams::Stream::executed(quint32 trial) {
+	// The trial was settled through the handle and retried
+	// or repeated before the executable returned
+	if(trial != _trial) return;
 
 	// If function returned an error the stream is considered failed
 	if(_executable->hasFailed()) {
@@ -620,41 +916,83 @@ void quickstreams::Stream::awake(
 	// There's no need for this stream to acquire ownership,
 	// it's okay for the wrapped stream to execute freely.
 	else if(_executable->hasReturnedStream()) {
-		connect(
-			_executable->stream(), &Stream::failed,
-			this, [this](QVariant reason) {
-				emitFailed(reason, WakeCondition::Default);
-			},
-			Qt::QueuedConnection
-		);
-		connect(
-			_executable->stream(), &Stream::closed,
-			this, [this](QVariant data, WakeCondition wakeCondition) {
-				Q_UNUSED(wakeCondition)
-				emitClosed(data);
-			},
-			Qt::QueuedConnection
-		);
+		wrap(_executable->stream());
 	}
 }
 
+void quickstreams::Stream::resumeDeferred() {
+	if(!_awakeDeferred) return;
+	_awakeDeferred = false;
+	QVariant data;
+	data.swap(_deferredData);
+	if(isDisposed()) return;
+	awake(std::move(data), _deferredWakeCondition);
+}
+
+void quickstreams::Stream::nextTrial() {
+	++_trial;
+	_handle._generation = _provider->renewSlot(_handle._slot);
+	if(_qmlStream) _qmlStream->renewHandle();
+}
+
+void quickstreams::Stream::setAborted() {
+	_state = State::Aborted;
+	_aborted.storeRelease(1);
+}
+
+void quickstreams::Stream::releasePermit(CircuitBreaker::Outcome outcome) {
+	if(_permit.kind == CircuitBreaker::Permit::Kind::None) return;
+	CircuitBreaker::Permit permit(_permit);
+	_permit = CircuitBreaker::Permit();
+	_breaker->release(permit, outcome);
+}
+
+void quickstreams::Stream::expire() {
+	// Streams that settled or are still delayed can't time out
+	if(isInactive() || _state == State::AwaitingDelay) return;
+
+	// Abort the returned stream and stop waiting for it
+	// to prevent it from settling a later trial
+	if(!_wrapped.isNull()) {
+		_wrapped->abort();
+		unwrap();
+	}
+	abortSubordinate();
+
+	Error error(
+		exception::TimeoutError::type(),
+		QString("stream timed out after %1 ms").arg(_timeout),
+		_timeout
+	);
+	emitFailed(
+		QVariant::fromValue<Error>(error),
+		isAborted() ? WakeCondition::Abort : WakeCondition::Default
+	);
+}
+
 void quickstreams::Stream::onInitialize() {
 	_state = State::Awaiting;
 	initializeSequences();
 }
 
-void quickstreams::Stream::onEliminateSequence() {
-	die();
-	eliminateSequence();
+quickstreams::Stream::Reference quickstreams::Stream::delay(qint32 duration) {
+	_delay = duration < 0 ? 0 : duration;
+	return _provider->reference(this);
 }
 
-quickstreams::Stream::Reference quickstreams::Stream::delay(qint32 duration) {
-	if(_awakeningTimer == nullptr) _awakeningTimer = new QTimer(this);
-	_awakeningTimer->setInterval(duration);
-	_awakeningTimer->setSingleShot(true);
+quickstreams::Stream::Reference quickstreams::Stream::guard(
+	const CircuitBreaker::Reference& breaker
+) {
+	_breaker = breaker;
 	return _provider->reference(this);
 }
 
+quickstreams::Stream::Reference quickstreams::Stream::guard(
+	const QString& name
+) {
+	return guard(_provider->circuitBreaker(name, CircuitBreaker::Policy()));
+}
+
 quickstreams::Stream::Reference quickstreams::Stream::retry(
 	Retryer::Reference newRetryer
 ) {
@@ -678,6 +1016,28 @@ quickstreams::Stream::Reference quickstreams::Stream::retry(
 	return retry(retryer);
 }
 
+quickstreams::Stream::Reference quickstreams::Stream::retry(
+	const TypeRetryer::TypeList& errorTypes,
+	const BackoffRetryer::Policy& backoff,
+	qint32 maxTrials
+) {
+	Retryer::Reference condition(new TypeRetryer(errorTypes, maxTrials));
+	return retry(Retryer::Reference(
+		new BackoffRetryer(condition, backoff, maxTrials)
+	));
+}
+
+quickstreams::Stream::Reference quickstreams::Stream::retry(
+	LambdaRetryer::Function function,
+	const BackoffRetryer::Policy& backoff,
+	qint32 maxTrials
+) {
+	Retryer::Reference condition(new LambdaRetryer(function, maxTrials));
+	return retry(Retryer::Reference(
+		new BackoffRetryer(condition, backoff, maxTrials)
+	));
+}
+
 quickstreams::Stream::Reference quickstreams::Stream::repeat(
 	Repeater::Reference newRepeater
 ) {
@@ -692,6 +1052,18 @@ quickstreams::Stream::Reference quickstreams::Stream::repeat(
 	return _provider->reference(this);
 }
 
+quickstreams::Stream::Reference quickstreams::Stream::offload() {
+	_offloaded = true;
+	return _provider->reference(this);
+}
+
+quickstreams::Stream::Reference quickstreams::Stream::timeout(
+	qint32 duration
+) {
+	_timeout = duration;
+	return _provider->reference(this);
+}
+
 quickstreams::Stream::Reference quickstreams::Stream::attach(
 	const Executable::Reference& executable
 ) {
@@ -767,8 +1139,6 @@ quickstreams::Stream::Reference quickstreams::Stream::failure(
 
 	auto reference(create(executable, Type::Atomic, CaptionStatus::Bound));
 	registerFailureSequence(reference.data());
-	propagateFailSeqDown(reference.data());
-	propagateFailSeqUp(reference.data());
 	return reference;
 }
 
@@ -784,8 +1154,6 @@ quickstreams::Stream::Reference quickstreams::Stream::failure(
 	verifyFailureSequenceStream(stream.data());
 
 	registerFailureSequence(stream.data());
-	propagateFailSeqDown(stream.data());
-	propagateFailSeqUp(stream.data());
 	stream->_captionStatus = CaptionStatus::Bound;
 	return stream;
 }
@@ -798,8 +1166,6 @@ quickstreams::Stream::Reference quickstreams::Stream::abortion(
 	auto reference(create(executable, Type::Atomic, CaptionStatus::Bound));
 	// When this stream was aborted - awake the abortion stream
 	registerAbortionSequence(reference.data());
-	propagateAbortSeqDown(reference.data());
-	propagateAbortSeqUp(reference.data());
 	return reference;
 }
 
@@ -816,8 +1182,6 @@ quickstreams::Stream::Reference quickstreams::Stream::abortion(
 
 	// When this stream was aborted - awake the abortion stream
 	registerAbortionSequence(stream.data());
-	propagateAbortSeqDown(stream.data());
-	propagateAbortSeqUp(stream.data());
 	stream->_captionStatus = CaptionStatus::Bound;
 	return stream;
 }
@@ -831,12 +1195,13 @@ void quickstreams::Stream::abort() {
 	// then cancel it in case it's attached or free.
 	// Only bound streams should block until the delay is over
 	if(_state == State::AwaitingDelay) {
-		_state = State::Aborted;
-		if(isAbortable() && _awakeningTimer != nullptr) {
-			_awakeningTimer->stop();
+		setAborted();
+		if(isAbortable()) {
+			_delayTimer.cancel();
+			_delayedData.clear();
 		}
 	} else {
-		_state = State::Aborted;
+		setAborted();
 		if(isAbortable()) abortSubordinate();
 	}
 }
@@ -853,6 +1218,20 @@ bool quickstreams::Stream::isAborted() const {
 	return _state == State::Aborted;
 }
 
+quint32 quickstreams::Stream::slot() const {
+	return _handle._slot;
+}
+
+bool quickstreams::Stream::isDisposed() const {
+	switch(_state) {
+	case State::Canceled:
+	case State::Dead:
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool quickstreams::Stream::isInactive() const {
 	switch(_state) {
 	case State::Active:
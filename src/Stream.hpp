@@ -11,7 +11,13 @@
 #include "Retryer.hpp"
 #include "TypeRetryer.hpp"
 #include "LambdaRetryer.hpp"
+#include "BackoffRetryer.hpp"
 #include "Callback.hpp"
+#include "Transition.hpp"
+#include "StreamPool.hpp"
+#include "TimerWheel.hpp"
+#include "CircuitBreaker.hpp"
+#include <cstddef>
 #include <QObject>
 #include <QJSValue>
 #include <QVariant>
@@ -19,12 +25,17 @@
 #include <QString>
 #include <QMetaType>
 #include <QMultiHash>
-#include <QTimer>
+#include <QVector>
 #include <QSharedPointer>
+#include <QAtomicInteger>
 
 namespace quickstreams {
 
 class Provider;
+class SequenceTemplate;
+class CombinatorExecutable;
+class MapExecutable;
+class HedgeExecutable;
 
 namespace qml {
 
@@ -36,12 +47,20 @@ class QmlProvider;
 class Stream : public QObject {
 	Q_OBJECT
 	friend class quickstreams::Provider;
+	friend class quickstreams::StreamHandle;
+	friend class quickstreams::SequenceTemplate;
+	friend class quickstreams::CombinatorExecutable;
+	friend class quickstreams::MapExecutable;
+	friend class quickstreams::HedgeExecutable;
 	friend class quickstreams::qml::QmlStream;
 	friend class quickstreams::qml::QmlProvider;
 
 public:
 	typedef QSharedPointer<quickstreams::Stream> Reference;
 
+	// Size of a single stream allocation including its allocation header
+	static const std::size_t AllocationSize;
+
 	enum class State : char {
 		Initializing,
 		Awaiting,
@@ -71,22 +90,63 @@ public:
 	static Executable::Reference Wrap(LambdaWrapper::Function function);
 
 protected:
+	typedef QVector<Stream*> Subordinates;
+
+	// The sequence descriptor is shared by all members of a sequence
+	// and holds the initial streams of the failure and abortion sequences
+	// registered on it. When two sequences are joined the descriptor
+	// of the joined sequence forwards to the descriptor of the joining one
+	struct Sequence {
+		Stream* failure;
+		Stream* abortion;
+		QSharedPointer<Sequence> forward;
+	};
+	typedef QSharedPointer<Sequence> SequenceReference;
+
 	ProviderInterface* _provider;
 	Type _type;
 	State _state;
+
+	// Mirrors whether the state is Aborted for handles
+	// reading it outside of the provider thread
+	QAtomicInteger<int> _aborted;
 	Captured _captured;
 	CaptionStatus _captionStatus;
 	Stream* _parent;
-	Stream* _failure;
-	Stream* _abortion;
+	Stream* _previous;
+	Stream* _next;
+	mutable SequenceReference _sequence;
+	Stream* _wrapper;
+	Reference _wrapped;
+	Subordinates _subordinates;
 	QMultiHash<QString, Callback::Reference> _observedEvents;
 	StreamHandle _handle;
 
+	// The QML wrapper of this stream if any, released when the stream dies
+	quickstreams::qml::QmlStream* _qmlStream;
+
 	// Optional members and operators
 	Executable::Reference _executable;
-	QTimer* _awakeningTimer;
+	qint32 _delay;
+	TimerWheel::Timer _delayTimer;
+	QVariant _delayedData;
+	WakeCondition _delayedWakeCondition;
 	Retryer::Reference _retryer;
 	Repeater::Reference _repeater;
+	bool _offloaded;
+
+	// Offloaded executables are never executed concurrently,
+	// the stream is awoken again only after the running execution
+	// was evaluated. Results of settled trials are dropped
+	bool _executing;
+	bool _awakeDeferred;
+	QVariant _deferredData;
+	WakeCondition _deferredWakeCondition;
+	quint32 _trial;
+	qint32 _timeout;
+	TimerWheel::Timer _timeoutTimer;
+	CircuitBreaker::Reference _breaker;
+	CircuitBreaker::Permit _permit;
 
 	explicit Stream(
 		ProviderInterface* provider,
@@ -96,6 +156,14 @@ protected:
 	);
 	~Stream();
 
+	// Streams are allocated either on the heap or in the stream pool
+	// of the provider. Every allocation remembers its origin so that
+	// the memory is always released to where it came from
+	static void* operator new(std::size_t size);
+	static void* operator new(std::size_t size, StreamPool* pool);
+	static void operator delete(void* pointer);
+	static void operator delete(void* pointer, StreamPool* pool);
+
 	Reference create(
 		const Executable::Reference& executable,
 		Type type,
@@ -112,6 +180,10 @@ protected:
 	void verifyBind() const;
 	void verifyBindStream(const Reference& stream) const;
 
+	// Throws an exception if this stream can't be launched by a combinator
+	// or a map because it's not a free, initializing stream
+	void verifyCombinable() const;
+
 	// Throws an exception if the attempt to register a failure sequence
 	// was faulty for any of the following reasons:
 	// 1. this stream already registered another failure sequence
@@ -136,38 +208,85 @@ protected:
 	// is a member of the sequence to branch off in case of abortion
 	void verifyAbortSeqStreamNotMember(Stream* stream) const;
 
+	// Returns the descriptor of the sequence this stream belongs to
+	// creating it if necessary and shortening forwarding chains
+	Sequence* sequence() const;
+
+	// Joins the sequence of the given preceding stream merging
+	// the failure and abortion sequences of both sequences.
+	// Those of the preceding stream take precedence
+	void joinSequence(Stream* predecessor);
+
+	// Returns the initial streams of the failure and abortion sequences
+	// registered on the sequence this stream belongs to if any
+	Stream* failureStream() const;
+	Stream* abortionStream() const;
+
 	// Registers the first stream of the sequence to awake
-	// when this stream fails.
-	// Recursively propagate it to the entire sequence
+	// when any member of the sequence this stream belongs to fails
 	void registerFailureSequence(Stream* failureStream);
-	void connectFailureSequence(Stream* failureStream);
 
-	// Registers the first stream of the sequence to awake
-	// when this stream is closed after it's aborted.
-	// Recursively propagate it to the entire sequence
+	// Registers the first stream of the sequence to awake when any member
+	// of the sequence this stream belongs to is closed after it's aborted
 	void registerAbortionSequence(Stream* abortionStream);
-	void connectAbortionSequence(Stream* abortionStream);
 
 	Reference adopt(Reference another);
 	void emitEvent(const QString& name, const QVariant& data) const;
-	void emitClosed(const QVariant& data);
+	void emitClosed(QVariant data);
 	void emitFailed(const QVariant& reason, WakeCondition wakeCondition);
 	void setSuperordinateStream(Stream* stream);
 	void connectSubsequent(Stream* stream);
 	void die();
 
-protected slots:
-	// The stream is asynchronously initialized
-	// after it's creation by the provider.
-	// If it remained uncaptured - thus free,
-	// it will be awoken right away
-	void initialize();
+	// Makes this stream close or fail when the given stream,
+	// returned by the executable, is closed or failed
+	void wrap(Stream* stream);
+	void unwrap();
+
+	// Schedules a transition of the given target stream for dispatch
+	// in a later event loop cycle. Disposed streams are never scheduled
+	void schedule(
+		Stream* target,
+		Transition::Kind kind,
+		QVariant data
+	);
 
-	void onPropagateFailSeqUp(Stream* initialStream);
-	void onPropagateFailSeqDown(Stream* initialStream);
+	// Dispatches a scheduled transition, called by the provider.
+	// The data of the transition is handed over to the target stream
+	void dispatch(Transition& transition);
 
-	void onPropagateAbortSeqUp(Stream* initialStream);
-	void onPropagateAbortSeqDown(Stream* initialStream);
+	// Awake the subsequent, failure and abortion sequences
+	// as well as the wrapping stream if any
+	void dispatchClosed(QVariant data, WakeCondition wakeCondition);
+	void dispatchFailed(const QVariant& reason);
+	void dispatchAborted(const QVariant& reason);
+
+	// Transits all subsequent streams as well as the failure and abortion
+	// sequences into the Awaiting state to prevent control flow
+	// manipulation at runtime
+	void initializeSequences();
+
+	// Transits this stream into the awaiting state
+	// and initializes the following sequences
+	void onInitialize();
+
+	// Cancels this stream and all subsequent streams
+	void eliminate();
+
+	// Eliminates the current sequence
+	void eliminateSequence();
+
+	// Eliminates the declared failure sequence
+	void eliminateFailureSequence();
+
+	// Eliminates the declared abortion sequence
+	void eliminateAbortionSequence();
+
+	// Aborts all subordinate streams
+	void abortSubordinate();
+
+	// Eliminates all subordinate streams
+	void eliminateSubordinate();
 
 	// Awakes this stream, when the preceding stream either closes
 	// or redirects control flow to this stream after a failure or an abortion
@@ -177,46 +296,53 @@ protected slots:
 			quickstreams::Stream::WakeCondition::Default
 	);
 
-	// Handles sequence initialization signals,
-	// must transit this stream into Awaiting state
-	// and reemit initializeSequences signal to subsequent streams
-	void onInitialize();
+	// Evaluates the results of the executable after it was executed
+	// either directly or on a worker thread of the provider scheduler.
+	// The results are dropped if the trial settled in the meantime
+	void executed(quint32 trial);
 
-	// Handles sequence eliminatation signal, must cancel this stream
-	// and recursively eliminate all subsequent streams
-	void onEliminateSequence();
+	// Awakes this stream if it was awoken while its offloaded
+	// executable was still executing
+	void resumeDeferred();
 
-signals:
-	void eventEmitted(QString name, QVariant data);
-	void closed(QVariant data, WakeCondition wakeCondition);
-	void failed(QVariant error, WakeCondition wakeCondition);
-	void aborted(QVariant reason, WakeCondition wakeCondition);
-	void retryIteration(QVariant data, WakeCondition wakeCondition);
-	void repeatIteration(QVariant data, WakeCondition wakeCondition);
-	void abortSubordinate();
+	// Settles the current trial before the stream is awoken again
+	// for a retrial or a repetition. Handles of the settled trial
+	// are invalidated so late calls can't settle the next trial
+	void nextTrial();
 
-	void propagateFailSeqUp(Stream* initialStream);
-	void propagateFailSeqDown(Stream* initialStream);
+	void setAborted();
 
-	void propagateAbortSeqUp(Stream* initialStream);
-	void propagateAbortSeqDown(Stream* initialStream);
+	// Releases the circuit breaker permit of the current trial if any
+	void releasePermit(CircuitBreaker::Outcome outcome);
 
-	// Eliminates all subordinate streams
-	void eliminateSubordinate();
+	// Fails this stream with a timeout error aborting the streams
+	// it waits for, called by the timer wheel when the timeout expires
+	void expire();
 
-	// Eliminates the current sequence recursively
-	void eliminateSequence();
+	// Returns the index of the provider slot this stream occupies
+	quint32 slot() const;
 
-	// Eliminates the declared failure sequence recursively
-	void eliminateFailureSequence();
+	// Returns true if this stream is either canceled or dead
+	// and thus no longer registered by the provider, otherwise returns false
+	bool isDisposed() const;
 
-	// Eliminates the declared abortion sequence recursively
-	void eliminateAbortionSequence();
+	// The stream is asynchronously initialized
+	// after it's creation by the provider.
+	// If it remained uncaptured - thus free,
+	// it will be awoken right away
+	void initialize();
 
-	// The Initialization signal is fired when the initial free stream
-	// is scheduled for execution. It makes subsequent streams transit into
-	// the awaiting state to prevent control flow manipulation at runtime
-	void initializeSequences();
+	// Initializes the sequences of this stream and awakes it
+	// passing the given data, used to start free and combined streams
+	void launch(const QVariant& data);
+
+signals:
+	// The following signals are never used to control the flow
+	// of sequences internally, they notify external observers only
+	void eventEmitted(QString name, QVariant data);
+	void closed(QVariant data, WakeCondition wakeCondition);
+	void failed(QVariant error, WakeCondition wakeCondition);
+	void aborted(QVariant reason, WakeCondition wakeCondition);
 
 public:
 	// delay is a stream operator, it delays the awakening of the stream
@@ -238,11 +364,51 @@ public:
 		qint32 maxTrials = -1
 	);
 
+	// Retrials of streams retried with a backoff policy are awoken
+	// only after backing off for the delay computed by the policy
+	Reference retry(
+		const TypeRetryer::TypeList& errorTypes,
+		const BackoffRetryer::Policy& backoff,
+		qint32 maxTrials = -1
+	);
+	Reference retry(
+		LambdaRetryer::Function function,
+		const BackoffRetryer::Policy& backoff,
+		qint32 maxTrials = -1
+	);
+
 	// repeat is a stream operator, it repeats resurrecting the current stream
 	// if the given condition returns true.
 	Reference repeat(Repeater::Reference newRepeater);
 	Reference repeat(LambdaRepeater::Function function);
 
+	// offload is a stream operator, it executes the executable of the stream
+	// on a worker thread of the provider scheduler instead of the provider
+	// thread. The stream itself remains on the provider thread, only
+	// the executable is offloaded. Offloaded executables must neither
+	// create streams nor return streams to be wrapped and must only
+	// interact with the stream through its handle.
+	// JavaScript executables must never be offloaded.
+	Reference offload();
+
+	// timeout is a stream operator, it fails the stream with
+	// an exception::TimeoutError if it doesn't close nor fail within
+	// the given amount of milliseconds after it was awoken.
+	// Every trial of a retried stream is timed separately.
+	// When the stream times out the stream returned by its executable
+	// as well as its abortable subordinate streams are aborted.
+	// A negative duration disables the timeout.
+	Reference timeout(qint32 duration);
+
+	// guard is a stream operator, it guards every trial of the stream
+	// by the given circuit breaker which is usually shared by many streams.
+	// While the breaker is open the stream fails fast with
+	// an exception::CircuitOpenError without executing its executable.
+	// Guarding by name refers to the circuit breaker registered
+	// in the provider under the given name creating it if necessary.
+	Reference guard(const CircuitBreaker::Reference& breaker);
+	Reference guard(const QString& name);
+
 
 	// attach is a stream operator, it creates a new stream that is awoken
 	// when the current stream is successfuly closed.
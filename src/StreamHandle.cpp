@@ -1,52 +1,152 @@
 #include "StreamHandle.hpp"
+#include "Stream.hpp"
+#include "ProviderInterface.hpp"
 #include <QVariant>
 #include <QString>
+#include <utility>
 
 quickstreams::StreamHandle::StreamHandle(
-	EventCallback eventCb,
-	CloseCallback closeCb,
-	FailCallback failCb,
-	AdoptCallback adoptCb,
-	IsAbortableCallback isAbortableCb,
-	IsAbortedCallback isAbortedCb
+	ProviderInterface* provider,
+	quint32 slot,
+	quint32 generation
 ) :
-	_eventCb(eventCb),
-	_closeCb(closeCb),
-	_failCb(failCb),
-	_adoptCb(adoptCb),
-	_isAbortableCb(isAbortableCb),
-	_isAbortedCb(isAbortedCb)
+	_provider(provider),
+	_slot(slot),
+	_generation(generation)
 {}
 
-quickstreams::StreamHandle::StreamHandle() {}
+quickstreams::StreamHandle::StreamHandle() :
+	_provider(nullptr),
+	_slot(0),
+	_generation(0)
+{}
+
+quickstreams::Stream* quickstreams::StreamHandle::stream() const {
+	if(_provider == nullptr) return nullptr;
+	return _provider->resolveSlot(_slot, _generation);
+}
 
 void quickstreams::StreamHandle::event(
 	const QString& name,
 	const QVariant& data
 ) const {
-	_eventCb(name, data);
+	if(_provider == nullptr) return;
+	if(!_provider->isOwnerThread()) {
+		const StreamHandle handle(*this);
+		_provider->post([handle, name, data]() {
+			handle.event(name, data);
+		});
+		return;
+	}
+
+	auto target(stream());
+	if(target == nullptr) return;
+	target->emitEvent(name, data);
 }
 
 void quickstreams::StreamHandle::close(const QVariant& data) const {
-	_closeCb(data);
+	if(_provider == nullptr) return;
+	if(!_provider->isOwnerThread()) {
+		const StreamHandle handle(*this);
+		_provider->post([handle, data]() {
+			handle.close(data);
+		});
+		return;
+	}
+
+	auto target(stream());
+	if(target == nullptr) return;
+	target->emitClosed(data);
+}
+
+void quickstreams::StreamHandle::close(QVariant&& data) const {
+	if(_provider == nullptr) return;
+	if(!_provider->isOwnerThread()) {
+		// Lambdas can't capture by move, the data is copied
+		// once when closing from outside of the provider thread
+		const QVariant copy(std::move(data));
+		close(copy);
+		return;
+	}
+
+	auto target(stream());
+	if(target == nullptr) return;
+	target->emitClosed(std::move(data));
 }
 
 void quickstreams::StreamHandle::fail(const QVariant& data) const {
-	_failCb(data);
+	if(_provider == nullptr) return;
+	if(!_provider->isOwnerThread()) {
+		const StreamHandle handle(*this);
+		_provider->post([handle, data]() {
+			handle.fail(data);
+		});
+		return;
+	}
+
+	auto target(stream());
+	if(target == nullptr) return;
+	target->emitFailed(data, Stream::WakeCondition::Default);
 }
 
 quickstreams::StreamHandle::StreamReference quickstreams::StreamHandle::adopt(
 	StreamReference stream
 ) const {
-	return _adoptCb(stream);
+	if(_provider == nullptr) return stream;
+	if(!_provider->isOwnerThread()) {
+		const StreamHandle handle(*this);
+		_provider->post([handle, stream]() {
+			handle.adopt(stream);
+		});
+		return stream;
+	}
+
+	auto target(this->stream());
+	if(target == nullptr) return stream;
+	return target->adopt(stream);
 }
 
 bool quickstreams::StreamHandle::isAbortable() const {
-	return _isAbortableCb();
+	// The type of a stream never changes after it was created
+	if(_provider == nullptr) return false;
+	_provider->lockSlots();
+	auto target(stream());
+	bool abortable(target != nullptr && target->isAbortable());
+	_provider->unlockSlots();
+	return abortable;
 }
 
 bool quickstreams::StreamHandle::isAborted() const {
-	return _isAbortedCb();
+	if(_provider == nullptr) return false;
+	_provider->lockSlots();
+	auto target(stream());
+	// The state is written by the provider thread, only the atomic
+	// mirror of the aborted state is safe to read on any thread
+	bool aborted(target != nullptr && target->_aborted.loadAcquire() != 0);
+	_provider->unlockSlots();
+	return aborted;
+}
+
+bool quickstreams::StreamHandle::isValid() const {
+	if(_provider == nullptr) return false;
+	_provider->lockSlots();
+	bool valid(stream() != nullptr);
+	_provider->unlockSlots();
+	return valid;
+}
+
+bool quickstreams::StreamHandle::operator==(
+	const StreamHandle& other
+) const {
+	return _provider == other._provider
+		&& _slot == other._slot
+		&& _generation == other._generation;
+}
+
+bool quickstreams::StreamHandle::operator!=(
+	const StreamHandle& other
+) const {
+	return !(*this == other);
 }
 
 Q_DECLARE_METATYPE(quickstreams::StreamHandle)
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <functional>
 #include <QString>
 #include <QVariant>
 #include <QSharedPointer>
@@ -8,6 +7,7 @@
 namespace quickstreams {
 
 class Stream;
+class ProviderInterface;
 
 namespace qml {
 
@@ -15,6 +15,13 @@ class QmlStreamHandle;
 
 }
 
+// The stream handle refers to its stream through a generational slot
+// of the provider rather than holding the stream directly. It's thus cheap
+// to copy and remains safe to use after the stream was destroyed,
+// in which case all calls are ignored.
+//
+// The handle can be used from any thread. Calls made outside of the
+// provider thread are executed on the provider thread in a later cycle.
 class StreamHandle {
 	friend class Stream;
 	friend class qml::QmlStreamHandle;
@@ -22,30 +29,21 @@ class StreamHandle {
 public:
 	typedef QSharedPointer<Stream> StreamReference;
 
-	typedef std::function<void(const QString&, const QVariant&)> EventCallback;
-	typedef std::function<void(const QVariant&)> CloseCallback;
-	typedef std::function<void(const QVariant&)> FailCallback;
-	typedef std::function<StreamReference(StreamReference&)> AdoptCallback;
-	typedef std::function<bool()> IsAbortableCallback;
-	typedef std::function<bool()> IsAbortedCallback;
-
 protected:
-	EventCallback _eventCb;
-	CloseCallback _closeCb;
-	FailCallback _failCb;
-	AdoptCallback _adoptCb;
-	IsAbortableCallback _isAbortableCb;
-	IsAbortedCallback _isAbortedCb;
+	ProviderInterface* _provider;
+	quint32 _slot;
+	quint32 _generation;
 
 	StreamHandle(
-		EventCallback eventCb,
-		CloseCallback closeCb,
-		FailCallback failCb,
-		AdoptCallback adoptCb,
-		IsAbortableCallback isAbortableCb,
-		IsAbortedCallback isAbortedCb
+		ProviderInterface* provider,
+		quint32 slot,
+		quint32 generation
 	);
 
+	// Returns the stream this handle refers to
+	// or null if the stream doesn't exist anymore
+	Stream* stream() const;
+
 public:
 	StreamHandle();
 
@@ -55,6 +53,10 @@ public:
 	// Immediately closes this stream optionally passing any data.
 	void close(const QVariant& data = QVariant()) const;
 
+	// Closes this stream handing the data over to the following stream
+	// without copying it
+	void close(QVariant&& data) const;
+
 	// Immediately fails the stream optionally passing any data
 	// describing the reason of failure.
 	void fail(const QVariant& data = QVariant()) const;
@@ -65,6 +67,13 @@ public:
 
 	bool isAbortable() const;
 	bool isAborted() const;
+
+	// Returns true if the stream this handle refers to still exists
+	bool isValid() const;
+
+	// Handles are equal if they refer to the same trial of the same stream
+	bool operator==(const StreamHandle& other) const;
+	bool operator!=(const StreamHandle& other) const;
 };
 
 } // quickstreams
@@ -0,0 +1,95 @@
+#include "StreamPool.hpp"
+#include <cstddef>
+#include <new>
+#include <QVector>
+#include <QAtomicInteger>
+
+quickstreams::StreamPool::StreamPool(
+	std::size_t blockSize,
+	int blocksPerSlab
+) :
+	// Round the block size up to keep all blocks properly aligned
+	_blockSize(
+		(blockSize + alignof(std::max_align_t) - 1)
+		/ alignof(std::max_align_t) * alignof(std::max_align_t)
+	),
+	_blocksPerSlab(blocksPerSlab < 1 ? 1 : blocksPerSlab),
+	_free(nullptr),
+	_hits(0),
+	_misses(0),
+	_references(1)
+{}
+
+quickstreams::StreamPool::~StreamPool() {
+	for(
+		Slabs::const_iterator itr(_slabs.constBegin());
+		itr != _slabs.constEnd();
+		itr++
+	) {
+		::operator delete(*itr);
+	}
+}
+
+void quickstreams::StreamPool::allocateSlab() {
+	auto slab(static_cast<char*>(
+		::operator new(_blockSize * std::size_t(_blocksPerSlab))
+	));
+	_slabs.append(slab);
+
+	// Chain the blocks in reverse order
+	// for them to be acquired in the order of their addresses
+	for(int itr(_blocksPerSlab - 1); itr >= 0; --itr) {
+		auto block(reinterpret_cast<Block*>(slab + _blockSize * itr));
+		block->next = _free;
+		_free = block;
+	}
+}
+
+void* quickstreams::StreamPool::acquire(std::size_t size) {
+	// Oversized allocations can't be served by the pool
+	if(size > _blockSize) throw std::bad_alloc();
+
+	if(_free == nullptr) {
+		++_misses;
+		allocateSlab();
+	} else {
+		++_hits;
+	}
+
+	auto block(_free);
+	_free = block->next;
+	_references.ref();
+	return block;
+}
+
+void quickstreams::StreamPool::release(void* block) {
+	if(block == nullptr) return;
+	auto released(static_cast<Block*>(block));
+	released->next = _free;
+	_free = released;
+	unreference();
+}
+
+void quickstreams::StreamPool::dispose() {
+	unreference();
+}
+
+void quickstreams::StreamPool::unreference() {
+	if(!_references.deref()) delete this;
+}
+
+void quickstreams::StreamPool::Disposer::cleanup(StreamPool* pool) {
+	if(pool != nullptr) pool->dispose();
+}
+
+std::size_t quickstreams::StreamPool::blockSize() const {
+	return _blockSize;
+}
+
+quint64 quickstreams::StreamPool::hits() const {
+	return _hits;
+}
+
+quint64 quickstreams::StreamPool::misses() const {
+	return _misses;
+}
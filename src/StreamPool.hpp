@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <QVector>
+#include <QAtomicInteger>
+
+namespace quickstreams {
+
+// The stream pool allocates fixed size blocks of memory in slabs
+// and recycles released blocks through a free list instead of returning
+// them to the heap. It's used by the provider to allocate streams
+// reducing allocation churn and heap fragmentation.
+// The pool is shared by its owner and its acquired blocks, it's destroyed
+// once disposed by its owner and all of its blocks are released
+// since streams may outlive the provider they were allocated by.
+class StreamPool {
+public:
+	// Disposes the pool owned by a scoped pointer
+	struct Disposer {
+		static void cleanup(StreamPool* pool);
+	};
+
+protected:
+	// A free block is reused to store the pointer to the next free block
+	struct Block {
+		Block* next;
+	};
+
+	typedef QVector<char*> Slabs;
+
+	std::size_t _blockSize;
+	int _blocksPerSlab;
+	Slabs _slabs;
+	Block* _free;
+	quint64 _hits;
+	quint64 _misses;
+
+	// Held by the owner and by each acquired block
+	QAtomicInteger<int> _references;
+
+	~StreamPool();
+
+	// Allocates a new slab and chains its blocks into the free list
+	void allocateSlab();
+
+	// Destroys the pool when the last reference is dropped
+	void unreference();
+
+public:
+	StreamPool(std::size_t blockSize, int blocksPerSlab = 64);
+
+	StreamPool(const StreamPool&) = delete;
+	StreamPool& operator=(const StreamPool&) = delete;
+
+	// Returns a block of at least the given size
+	void* acquire(std::size_t size);
+
+	// Returns the block to the free list for it to be recycled
+	void release(void* block);
+
+	// Drops the reference of the owner
+	void dispose();
+
+	std::size_t blockSize() const;
+
+	// Returns the number of allocations served without allocating memory
+	quint64 hits() const;
+
+	// Returns the number of allocations that required a new slab
+	quint64 misses() const;
+};
+
+} // quickstreams
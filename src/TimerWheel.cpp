@@ -0,0 +1,214 @@
+#include "TimerWheel.hpp"
+#include <QObject>
+
+quickstreams::TimerWheel::Link::Link() :
+	prev(this),
+	next(this)
+{}
+
+void quickstreams::TimerWheel::Link::unlink() {
+	prev->next = next;
+	next->prev = prev;
+	prev = this;
+	next = this;
+}
+
+void quickstreams::TimerWheel::Link::append(Link* link) {
+	link->prev = prev;
+	link->next = this;
+	prev->next = link;
+	prev = link;
+}
+
+bool quickstreams::TimerWheel::Link::isEmpty() const {
+	return next == this;
+}
+
+void quickstreams::TimerWheel::Link::splice(Link* list) {
+	if(list->isEmpty()) return;
+	next = list->next;
+	prev = list->prev;
+	next->prev = this;
+	prev->next = this;
+	list->next = list;
+	list->prev = list;
+}
+
+quickstreams::TimerWheel::Timer::Timer() :
+	_wheel(nullptr),
+	_expires(0),
+	_level(0)
+{}
+
+quickstreams::TimerWheel::Timer::~Timer() {
+	cancel();
+}
+
+void quickstreams::TimerWheel::Timer::setCallback(Callback callback) {
+	_callback = callback;
+}
+
+void quickstreams::TimerWheel::Timer::cancel() {
+	if(_wheel == nullptr) return;
+	unlink();
+	_wheel->_counts[_level]--;
+	_wheel = nullptr;
+}
+
+bool quickstreams::TimerWheel::Timer::isActive() const {
+	return _wheel != nullptr;
+}
+
+quickstreams::TimerWheel::TimerWheel() :
+	_current(0),
+	_wakeup(0)
+{
+	for(int level(0); level < Levels; level++) _counts[level] = 0;
+	_clock.start();
+	_driver.setSingleShot(true);
+	_driver.setTimerType(Qt::PreciseTimer);
+	QObject::connect(&_driver, &QTimer::timeout, &_driver, [this]() {
+		advance();
+	});
+}
+
+quickstreams::TimerWheel::~TimerWheel() {
+	// Detach all scheduled timers, they're owned by their users
+	for(int level(0); level < Levels; level++) {
+		for(int slot(0); slot < Slots; slot++) {
+			Link& list(_slots[level][slot]);
+			while(!list.isEmpty()) {
+				Timer* timer(static_cast<Timer*>(list.next));
+				timer->unlink();
+				timer->_wheel = nullptr;
+			}
+		}
+	}
+}
+
+quint64 quickstreams::TimerWheel::now() const {
+	return quint64(_clock.elapsed());
+}
+
+void quickstreams::TimerWheel::place(Timer* timer) {
+	quint64 expires(timer->_expires);
+	quint64 delta(expires - _current);
+
+	// Timers expiring beyond the range of the top level are placed
+	// in its farthest slot and relinked when it's cascaded
+	const quint64 range(quint64(1) << (SlotBits * Levels));
+	if(delta >= range) expires = _current + range - 1;
+
+	int level(0);
+	while(
+		level < Levels - 1
+		&& delta >= (quint64(1) << (SlotBits * (level + 1)))
+	) level++;
+
+	int slot(int((expires >> (SlotBits * level)) & (Slots - 1)));
+	timer->_level = level;
+	_slots[level][slot].append(timer);
+	_counts[level]++;
+}
+
+void quickstreams::TimerWheel::cascade(int level) {
+	int slot(int((_current >> (SlotBits * level)) & (Slots - 1)));
+	Link timers;
+	timers.splice(&_slots[level][slot]);
+	while(!timers.isEmpty()) {
+		Timer* timer(static_cast<Timer*>(timers.next));
+		timer->unlink();
+		_counts[level]--;
+		place(timer);
+	}
+}
+
+void quickstreams::TimerWheel::advance() {
+	const quint64 target(now());
+	while(_current < target) {
+		if(size() < 1) {
+			_current = target;
+			break;
+		}
+
+		// Skip idle ticks up to the next cascade
+		// when no timer is due on the lowest level
+		if(_counts[0] < 1) {
+			quint64 boundary((_current | (Slots - 1)) + 1);
+			if(boundary > target) {
+				_current = target;
+				break;
+			}
+			_current = boundary - 1;
+		}
+		_current++;
+
+		// Cascade the higher levels whose lower levels wrapped around,
+		// the highest level first
+		int level(1);
+		while(
+			level < Levels
+			&& (_current & ((quint64(1) << (SlotBits * level)) - 1)) == 0
+		) level++;
+		for(level--; level > 0; level--) cascade(level);
+
+		// Execute the callbacks of all expired timers.
+		// A callback may cancel or reschedule any other timer
+		Link expired;
+		expired.splice(&_slots[0][_current & (Slots - 1)]);
+		while(!expired.isEmpty()) {
+			Timer* timer(static_cast<Timer*>(expired.next));
+			timer->cancel();
+			if(timer->_callback) timer->_callback();
+		}
+	}
+	rearm();
+}
+
+void quickstreams::TimerWheel::rearm() {
+	if(size() < 1) {
+		_driver.stop();
+		return;
+	}
+
+	// Wake up at the next occupied slot of the lowest level
+	// or at the next cascade if the lowest level is empty.
+	// Timers of the higher levels may be due right after the next cascade
+	// so the wheel never sleeps past it while they hold any timers
+	const quint64 boundary((_current | (Slots - 1)) + 1);
+	quint64 next(boundary);
+	if(_counts[0] > 0) {
+		for(quint64 tick(_current + 1); tick < _current + Slots; tick++) {
+			if(!_slots[0][tick & (Slots - 1)].isEmpty()) {
+				next = tick;
+				break;
+			}
+		}
+		if(next > boundary && size() > _counts[0]) next = boundary;
+	}
+
+	_wakeup = next;
+	const quint64 time(now());
+	_driver.start(next > time ? int(next - time) : 0);
+}
+
+void quickstreams::TimerWheel::schedule(Timer* timer, qint32 duration) {
+	timer->cancel();
+
+	// An idle wheel catches up without processing any ticks
+	if(size() < 1) _current = now();
+
+	timer->_wheel = this;
+	timer->_expires = now() + quint64(qMax(duration, 0));
+	if(timer->_expires <= _current) timer->_expires = _current + 1;
+	place(timer);
+
+	// Only rearm the driver if it would fire too late
+	if(!_driver.isActive() || timer->_expires < _wakeup) rearm();
+}
+
+int quickstreams::TimerWheel::size() const {
+	int size(0);
+	for(int level(0); level < Levels; level++) size += _counts[level];
+	return size;
+}
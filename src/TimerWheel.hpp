@@ -0,0 +1,107 @@
+#pragma once
+
+#include <functional>
+#include <QTimer>
+#include <QElapsedTimer>
+
+namespace quickstreams {
+
+// The timer wheel is a hierarchical hashed timing wheel driving any number
+// of timers by a single QTimer. Scheduling and canceling a timer
+// are constant time operations. The wheel has a resolution of one
+// millisecond and must only be used on the thread it lives in.
+class TimerWheel {
+public:
+	// Number of slots per level is 2^SlotBits
+	static const int SlotBits = 6;
+	static const int Slots = 1 << SlotBits;
+	static const int Levels = 4;
+
+protected:
+	// Timers are intrusively linked into circular lists
+	// each headed by a sentinel link
+	struct Link {
+		Link* prev;
+		Link* next;
+
+		Link();
+		void unlink();
+		void append(Link* link);
+		bool isEmpty() const;
+
+		// Moves all links of the given list into this empty list
+		void splice(Link* list);
+	};
+
+public:
+	typedef std::function<void()> Callback;
+
+	// A timer is owned by its user and linked into the wheel when scheduled.
+	// A timer is automatically canceled when it's destroyed
+	class Timer : protected Link {
+		friend class TimerWheel;
+
+	protected:
+		TimerWheel* _wheel;
+		quint64 _expires;
+		int _level;
+		Callback _callback;
+
+	public:
+		Timer();
+		~Timer();
+
+		Timer(const Timer&) = delete;
+		Timer& operator=(const Timer&) = delete;
+
+		// Sets the callback executed when the timer expires
+		void setCallback(Callback callback);
+
+		// Removes the timer from the wheel if it's scheduled
+		void cancel();
+
+		// Returns true if the timer is scheduled, otherwise returns false
+		bool isActive() const;
+	};
+
+protected:
+	Link _slots[Levels][Slots];
+	int _counts[Levels];
+	quint64 _current;
+	quint64 _wakeup;
+	QElapsedTimer _clock;
+	QTimer _driver;
+
+	// Returns the number of milliseconds elapsed since the wheel was created
+	quint64 now() const;
+
+	// Links the timer into the slot it expires in relative to the current tick
+	void place(Timer* timer);
+
+	// Relinks all timers of the current slot of the given level
+	// into the lower levels
+	void cascade(int level);
+
+	// Processes all ticks elapsed since the last advancement
+	// executing the callbacks of expired timers
+	void advance();
+
+	// Restarts the driver to fire when the next timer may expire
+	void rearm();
+
+public:
+	TimerWheel();
+	~TimerWheel();
+
+	TimerWheel(const TimerWheel&) = delete;
+	TimerWheel& operator=(const TimerWheel&) = delete;
+
+	// Schedules the timer to expire after the given amount of milliseconds
+	// rescheduling it if it's already scheduled
+	void schedule(Timer* timer, qint32 duration);
+
+	// Returns the number of scheduled timers
+	int size() const;
+};
+
+} // quickstreams
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <QVariant>
+#include <QSharedPointer>
+#include <utility>
+
+namespace quickstreams {
+
+class Stream;
+
+// A transition describes a deferred change of control flow between streams.
+// Transitions are scheduled by streams and dispatched by the provider
+// in a later event loop cycle. The target reference keeps the target stream
+// alive until the transition is dispatched. Transitions are swapped
+// rather than copied in and out of the queue to hand the data over
+// from stream to stream without copying it.
+struct Transition {
+	enum class Kind : char {
+		// Initializes the target stream which awakes it if it's free
+		Initialize,
+
+		// Awakes the target stream
+		Awake,
+
+		// Awakes the target stream transiting it into the aborted state
+		AwakeAborted,
+
+		// Closes the target stream because the stream it wraps was closed
+		Close,
+
+		// Fails the target stream because the stream it wraps failed
+		Fail
+	};
+
+	QSharedPointer<Stream> target;
+	Kind kind;
+	QVariant data;
+
+	// Exchanges the transitions without copying the data
+	void swap(Transition& other) {
+		target.swap(other.target);
+		std::swap(kind, other.kind);
+		data.swap(other.data);
+	}
+};
+
+} // quickstreams
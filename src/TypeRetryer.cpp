@@ -1,6 +1,6 @@
 #include "Retryer.hpp"
 #include "TypeRetryer.hpp"
-#include "Error.hpp"
+#include "ErrorMatcher.hpp"
 #include <QVariant>
 #include <QVariantList>
 
@@ -8,9 +8,9 @@ quickstreams::TypeRetryer::TypeRetryer(
 	const TypeList& errorTypes, qint32 maxTrials
 ) :
 	Retryer(maxTrials),
-	_errorTypes(errorTypes)
+	_matcher(errorTypes)
 {}
 
 bool quickstreams::TypeRetryer::verifyCondition(const QVariant& error) {
-	return _errorTypes.contains(error.value<Error>().type());
+	return _matcher.matches(error);
 }
@@ -2,17 +2,20 @@
 
 #include "Retryer.hpp"
 #include "TypeRetryer.hpp"
+#include "ErrorMatcher.hpp"
 #include <QVariant>
 #include <QVector>
 
 namespace quickstreams {
 
+// The type retryer retries errors of the given types
+// or of any of their descendant exception types
 class TypeRetryer : public Retryer {
 public:
-	typedef QVector<int> TypeList;
+	typedef ErrorMatcher::TypeList TypeList;
 
 protected:
-	TypeList _errorTypes;
+	ErrorMatcher _matcher;
 
 public:
 	TypeRetryer(const TypeList& errorTypes, qint32 maxTrials);
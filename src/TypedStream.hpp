@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Stream.hpp"
+#include "StreamHandle.hpp"
+#include "Provider.hpp"
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <QVariant>
+#include <QSharedPointer>
+
+namespace quickstreams {
+
+// A typed value slot shared by the stream producing the value
+// and the stream consuming it. Typed streams move their values
+// through these slots instead of boxing them into QVariants,
+// the streams themselves are awoken with null data
+template<typename T>
+struct TypedValue {
+	typedef QSharedPointer<TypedValue<T>> Reference;
+	T value;
+};
+
+// The typed handle closes a typed stream moving the value into its slot
+template<typename T>
+class TypedHandle {
+protected:
+	StreamHandle _handle;
+	typename TypedValue<T>::Reference _slot;
+
+public:
+	TypedHandle(
+		const StreamHandle& handle,
+		const typename TypedValue<T>::Reference& slot
+	) :
+		_handle(handle),
+		_slot(slot)
+	{}
+
+	void close(T value) const {
+		_slot->value = std::move(value);
+		_handle.close();
+	}
+
+	void fail(const QVariant& reason = QVariant()) const {
+		_handle.fail(reason);
+	}
+
+	void event(const QString& name, const QVariant& data = QVariant()) const {
+		_handle.event(name, data);
+	}
+
+	bool isAborted() const {
+		return _handle.isAborted();
+	}
+
+	const StreamHandle& handle() const {
+		return _handle;
+	}
+};
+
+// The typed stream is a header-only layer on top of the QVariant based
+// stream API passing values of type T between steps by moving them.
+// Values are only converted from and to QVariants by fromVariant
+// and toVariant, which is where typed chains meet untyped (QML) ones.
+// A typed step receives an rvalue reference to the value of the previous
+// step, a step that is retried or repeated receives the very same value
+// again unless it moved from it.
+template<typename T>
+class TypedStream {
+	template<typename> friend class TypedStream;
+
+protected:
+	Provider* _provider;
+	Stream::Reference _stream;
+	typename TypedValue<T>::Reference _slot;
+
+	TypedStream(
+		Provider* provider,
+		const Stream::Reference& stream,
+		const typename TypedValue<T>::Reference& slot
+	) :
+		_provider(provider),
+		_stream(stream),
+		_slot(slot)
+	{}
+
+public:
+	typedef std::function<void (const TypedHandle<T>&)> Function;
+
+	// Creates a new free typed stream closed through the typed handle
+	static TypedStream<T> create(
+		Provider* provider,
+		Function function,
+		Stream::Type type = Stream::Type::Atomic
+	) {
+		typename TypedValue<T>::Reference slot(new TypedValue<T>());
+		auto stream(provider->create([slot, function](
+			const StreamHandle& handle, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			function(TypedHandle<T>(handle, slot));
+		}, type));
+		return TypedStream<T>(provider, stream, slot);
+	}
+
+	// Attaches a typed stream to the given untyped stream
+	// converting the data it closes with to T
+	static TypedStream<T> fromVariant(
+		Provider* provider,
+		const Stream::Reference& stream
+	) {
+		typename TypedValue<T>::Reference slot(new TypedValue<T>());
+		auto next(stream->attach([slot](const QVariant& data) {
+			slot->value = data.value<T>();
+			return QVariant();
+		}));
+		return TypedStream<T>(provider, next, slot);
+	}
+
+	// Attaches a synchronous step transforming the value
+	// into the value of the returned typed stream
+	template<typename F>
+	TypedStream<typename std::result_of<F(T&&)>::type> attach(F function) {
+		typedef typename std::result_of<F(T&&)>::type R;
+		static_assert(
+			!std::is_void<R>::value,
+			"QuickStreams - typed steps must return a value"
+		);
+		auto input(_slot);
+		typename TypedValue<R>::Reference output(new TypedValue<R>());
+		auto next(_stream->attach([input, output, function](
+			const QVariant& data
+		) {
+			Q_UNUSED(data)
+			output->value = function(std::move(input->value));
+			return QVariant();
+		}));
+		return TypedStream<R>(_provider, next, output);
+	}
+
+	// Attaches an asynchronous abortable step receiving the value
+	// and closing the returned typed stream through the typed handle
+	template<typename R>
+	TypedStream<R> attachAsync(
+		std::function<void (T&&, const TypedHandle<R>&)> function
+	) {
+		auto input(_slot);
+		typename TypedValue<R>::Reference output(new TypedValue<R>());
+		auto next(_stream->attach(_provider->create([input, output, function](
+			const StreamHandle& handle, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			function(std::move(input->value), TypedHandle<R>(handle, output));
+		}, Stream::Type::Abortable)));
+		return TypedStream<R>(_provider, next, output);
+	}
+
+	// Attaches an untyped stream closing with the value converted
+	// to a QVariant, the value type must be a registered meta type
+	Stream::Reference toVariant() {
+		auto input(_slot);
+		return _stream->attach([input](const QVariant& data) {
+			Q_UNUSED(data)
+			return QVariant::fromValue<T>(input->value);
+		});
+	}
+
+	// Registers the failure sequence, errors are untyped
+	Stream::Reference failure(LambdaSyncExecutable::Function function) {
+		return _stream->failure(function);
+	}
+
+	// Returns the underlying untyped stream to apply
+	// any other stream operator to
+	const Stream::Reference& stream() const {
+		return _stream;
+	}
+};
+
+} // quickstreams
@@ -0,0 +1,171 @@
+#include "WorkStealingScheduler.hpp"
+#include <QThread>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+
+quickstreams::WorkStealingScheduler::Worker::Worker(
+	WorkStealingScheduler* scheduler,
+	int index
+) :
+	QThread(nullptr),
+	_scheduler(scheduler),
+	_index(index)
+{}
+
+void quickstreams::WorkStealingScheduler::Worker::run() {
+	Task task;
+	while(_scheduler->take(this, task)) {
+		_scheduler->_executed.fetchAndAddRelaxed(1);
+		task();
+		task = nullptr;
+	}
+}
+
+quickstreams::WorkStealingScheduler::WorkStealingScheduler(int workers) :
+	_next(0),
+	_pending(0),
+	_sleeping(0),
+	_stopping(false),
+	_executed(0),
+	_localPops(0),
+	_steals(0),
+	_idleTime(0)
+{
+	if(workers < 1) workers = 1;
+	for(int itr(0); itr < workers; ++itr) {
+		_workers.append(new Worker(this, itr));
+	}
+
+	// Start the workers only after all of them were created
+	// because they immediately start stealing from each other
+	for(
+		Workers::const_iterator itr(_workers.constBegin());
+		itr != _workers.constEnd();
+		itr++
+	) {
+		(*itr)->start();
+	}
+}
+
+quickstreams::WorkStealingScheduler::~WorkStealingScheduler() {
+	{
+		QMutexLocker lock(&_sleepLock);
+		_stopping = true;
+		_wakeup.wakeAll();
+	}
+	for(
+		Workers::const_iterator itr(_workers.constBegin());
+		itr != _workers.constEnd();
+		itr++
+	) {
+		(*itr)->wait();
+		delete *itr;
+	}
+}
+
+quickstreams::WorkStealingScheduler::Worker*
+quickstreams::WorkStealingScheduler::currentWorker() const {
+	auto worker(dynamic_cast<Worker*>(QThread::currentThread()));
+	if(worker == nullptr || worker->_scheduler != this) return nullptr;
+	return worker;
+}
+
+bool quickstreams::WorkStealingScheduler::popLocal(
+	Worker* worker,
+	Task& task
+) {
+	QMutexLocker lock(&worker->_lock);
+	if(worker->_tasks.isEmpty()) return false;
+
+	// Pop the most recently pushed task which is most likely to be cache-hot
+	task = worker->_tasks.takeLast();
+	return true;
+}
+
+bool quickstreams::WorkStealingScheduler::steal(Worker* thief, Task& task) {
+	const int count(_workers.size());
+	for(int itr(1); itr < count; ++itr) {
+		auto victim(_workers.at((thief->_index + itr) % count));
+		QMutexLocker lock(&victim->_lock);
+		if(victim->_tasks.isEmpty()) continue;
+
+		// Steal the oldest task to keep out of the way of the victim
+		task = victim->_tasks.takeFirst();
+		return true;
+	}
+	return false;
+}
+
+bool quickstreams::WorkStealingScheduler::take(Worker* worker, Task& task) {
+	for(;;) {
+		if(popLocal(worker, task)) {
+			_pending.fetchAndAddOrdered(-1);
+			_localPops.fetchAndAddRelaxed(1);
+			return true;
+		}
+		if(steal(worker, task)) {
+			_pending.fetchAndAddOrdered(-1);
+			_steals.fetchAndAddRelaxed(1);
+			return true;
+		}
+
+		QMutexLocker lock(&_sleepLock);
+
+		// Announce sleeping before checking for pending tasks,
+		// posters check for sleepers after announcing a pending task.
+		// Thus either this worker sees the task or the poster wakes it up
+		_sleeping.fetchAndAddOrdered(1);
+		if(_pending.fetchAndAddOrdered(0) > 0) {
+			_sleeping.fetchAndAddOrdered(-1);
+			continue;
+		}
+		if(_stopping) {
+			_sleeping.fetchAndAddOrdered(-1);
+			return false;
+		}
+
+		QElapsedTimer idle;
+		idle.start();
+		_wakeup.wait(&_sleepLock);
+		_idleTime.fetchAndAddRelaxed(quint64(idle.nsecsElapsed()));
+		_sleeping.fetchAndAddOrdered(-1);
+	}
+}
+
+void quickstreams::WorkStealingScheduler::post(const Task& task) {
+	// Workers push to their own queue,
+	// other threads distribute the tasks round robin
+	auto target(currentWorker());
+	if(target == nullptr) {
+		target = _workers.at(
+			int(_next.fetchAndAddRelaxed(1) % quint32(_workers.size()))
+		);
+	}
+	{
+		QMutexLocker lock(&target->_lock);
+		target->_tasks.append(task);
+	}
+
+	// Only take the global lock if there are sleeping workers to wake up
+	_pending.fetchAndAddOrdered(1);
+	if(_sleeping.fetchAndAddOrdered(0) > 0) {
+		QMutexLocker lock(&_sleepLock);
+		_wakeup.wakeOne();
+	}
+}
+
+int quickstreams::WorkStealingScheduler::workers() const {
+	return _workers.size();
+}
+
+quickstreams::Scheduler::Statistics
+quickstreams::WorkStealingScheduler::statistics() const {
+	return Statistics{
+		_executed.load(),
+		_localPops.load(),
+		_steals.load(),
+		_idleTime.load()
+	};
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Scheduler.hpp"
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QList>
+#include <QVector>
+#include <QAtomicInteger>
+
+namespace quickstreams {
+
+// The work stealing scheduler gives each worker thread its own task queue.
+// Tasks posted by a worker are pushed to its own queue and popped LIFO,
+// tasks posted by other threads are distributed round robin. Idle workers
+// steal the oldest tasks from the queues of other workers. Tasks still
+// queued when the scheduler is destroyed are executed before the workers
+// are stopped.
+class WorkStealingScheduler : public Scheduler {
+protected:
+	class Worker : public QThread {
+		friend class WorkStealingScheduler;
+
+	protected:
+		WorkStealingScheduler* _scheduler;
+		int _index;
+		QMutex _lock;
+		QList<Task> _tasks;
+
+		void run();
+
+	public:
+		Worker(WorkStealingScheduler* scheduler, int index);
+	};
+
+	typedef QVector<Worker*> Workers;
+
+	Workers _workers;
+	QAtomicInteger<quint32> _next;
+	QAtomicInteger<int> _pending;
+	QAtomicInteger<int> _sleeping;
+	QMutex _sleepLock;
+	QWaitCondition _wakeup;
+	bool _stopping;
+
+	QAtomicInteger<quint64> _executed;
+	QAtomicInteger<quint64> _localPops;
+	QAtomicInteger<quint64> _steals;
+	QAtomicInteger<quint64> _idleTime;
+
+	// Returns the worker of this scheduler the current thread belongs to
+	// or null if called from any other thread
+	Worker* currentWorker() const;
+
+	bool popLocal(Worker* worker, Task& task);
+	bool steal(Worker* thief, Task& task);
+
+	// Blocks until a task is available and returns true,
+	// returns false if the scheduler is stopping and no tasks are left
+	bool take(Worker* worker, Task& task);
+
+public:
+	explicit WorkStealingScheduler(int workers = QThread::idealThreadCount());
+	~WorkStealingScheduler();
+
+	void post(const Task& task);
+	int workers() const;
+	Statistics statistics() const;
+};
+
+} // quickstreams
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QuickStreams>
+
+// Custom exception classes translated from the custom errors of tests
+class QuotaExceededError : public quickstreams::exception::RuntimeError {
+	Q_OBJECT
+
+public:
+	QuotaExceededError() {}
+	QuotaExceededError(const QString& msg) : RuntimeError(msg) {}
+};
+
+class ServiceUnavailableError : public quickstreams::exception::Exception {
+	Q_OBJECT
+
+public:
+	ServiceUnavailableError() {}
+	ServiceUnavailableError(const QString& msg) : Exception(msg) {}
+};
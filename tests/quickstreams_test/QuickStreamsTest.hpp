@@ -16,6 +16,7 @@ private slots:
 	// Attach operator tests
 	void attach();
 	void attach_sequence();
+	void attach_wrapped();
 
 	// Failure operator tests
 	void failure_noFail();
@@ -25,16 +26,77 @@ private slots:
 	void failure_recoverySequence();
 	void failure_data_stdRuntimeError();
 	void failure_data_string();
+	void failure_data_compactError();
+	void failure_joinedSequence();
 
 	// Retry operator tests
 	void retry_onCondition();
 	void retry_onCondition_false();
 	void retry_onCondition_maxReach();
 	void retry_onType();
+	void retry_onCustomType();
+	void retry_onType_hierarchy();
 	void retry_onType_mismatchTypes();
 	void retry_onType_maxReach();
+	void retry_backoff();
+
+	// Circuit breaker tests
+	void guard_circuitBreaker();
+	void guard_staleProbe();
+
+	// Delay operator tests
+	void delay_abortable();
+
+	// Timeout operator tests
+	void timeout_retry();
+	void timeout_lateClose();
 
 	// Memory and state management tests
 	void sequenceInitialization();
 	void memory();
+	void memory_qmlWrapper();
+
+	// Stream handle tests
+	void handle_afterDestruction();
+
+	// Combinator tests
+	void combinator_all();
+	void combinator_any();
+	void combinator_race();
+	void combinator_abort();
+	void combinator_captured();
+
+	// Hedge operator tests
+	void hedge_slowAttempt();
+	void hedge_abort();
+
+	// Map operator tests
+	void map_concurrent();
+	void map_abort();
+	void map_unordered();
+	void map_synchronous();
+
+	// Typed stream tests
+	void typed_moveChain();
+
+	// Sequence template tests
+	void template_instantiate();
+
+	// Timer wheel tests
+	void timerWheel_mixedLevels();
+
+	// Offload operator tests
+	void offload_workerThread();
+	void offload_workStealing();
+	void offload_timeoutRetry();
+
+	// Benchmarks
+	void benchmark_payloadCopies();
+	void benchmark_jsSteps();
+
+	// Provider tests
+	void provider_dispatchBudget();
+	void provider_streamPooling();
+	void provider_statisticsInterval();
+	void provider_shardedCounter();
 };
@@ -25,10 +25,47 @@ SOURCES +=  \
     tests/retry_onCondition.cpp \
     tests/retry_onCondition_false.cpp \
     tests/retry_onCondition_maxReach.cpp \
-    tests/retry_onType_maxReached.cpp
+    tests/retry_onType_maxReached.cpp \
+    tests/attach_wrapped.cpp \
+    tests/provider_dispatchBudget.cpp \
+    tests/provider_streamPooling.cpp \
+    tests/handle_afterDestruction.cpp \
+    tests/template_instantiate.cpp \
+    tests/failure_joinedSequence.cpp \
+    tests/offload_workerThread.cpp \
+    tests/offload_workStealing.cpp \
+    tests/combinator_all.cpp \
+    tests/combinator_any.cpp \
+    tests/combinator_race.cpp \
+    tests/map_concurrent.cpp \
+    tests/timeout_retry.cpp \
+    tests/delay_abortable.cpp \
+    tests/retry_backoff.cpp \
+    tests/guard_circuitBreaker.cpp \
+    tests/hedge_slowAttempt.cpp \
+    tests/typed_moveChain.cpp \
+    tests/benchmark_payloadCopies.cpp \
+    tests/provider_statisticsInterval.cpp \
+    tests/provider_shardedCounter.cpp \
+    tests/failure_data_compactError.cpp \
+    tests/retry_onCustomType.cpp \
+    tests/retry_onType_hierarchy.cpp \
+    tests/benchmark_jsSteps.cpp \
+    tests/memory_qmlWrapper.cpp \
+    tests/offload_timeoutRetry.cpp \
+    tests/combinator_abort.cpp \
+    tests/map_abort.cpp \
+    tests/map_unordered.cpp \
+    tests/timerWheel_mixedLevels.cpp \
+    tests/timeout_lateClose.cpp \
+    tests/guard_staleProbe.cpp \
+    tests/hedge_abort.cpp \
+    tests/combinator_captured.cpp \
+    tests/map_synchronous.cpp
 
 HEADERS += \
     Trigger.hpp \
+    CustomErrors.hpp \
     QuickStreamsTest.hpp
 
 include(../../QuickStreams.pri)
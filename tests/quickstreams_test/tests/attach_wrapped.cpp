@@ -0,0 +1,65 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify a stream wrapping the stream returned by its executable is closed
+// when the returned stream closes and the data is passed correctly.
+void QuickStreamsTest::attach_wrapped() {
+	Trigger cpFirst;
+	Trigger cpWrapped;
+	Trigger cpAttached;
+
+	QList<QString> awakeningOrder;
+	QVariant passedData;
+
+	auto firstStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		awakeningOrder.append("first");
+		stream.close();
+		cpFirst.trigger();
+	});
+
+	auto wrappingStream = firstStream->attach(Stream::Wrap([&](
+		const QVariant& data
+	) {
+		Q_UNUSED(data)
+		awakeningOrder.append("wrapping");
+		return streams->create([&](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			awakeningOrder.append("wrapped");
+			QTimer::singleShot(10, [stream] {
+				stream.close("wrapped data");
+			});
+			cpWrapped.trigger();
+		});
+	}));
+
+	auto attachedStream = wrappingStream->attach([&](const QVariant& data) {
+		passedData = data;
+		awakeningOrder.append("attached");
+		cpAttached.trigger();
+		return QVariant();
+	});
+
+	Q_UNUSED(attachedStream)
+
+	QVERIFY(cpFirst.wait(100));
+	QVERIFY(cpWrapped.wait(100));
+	QVERIFY(cpAttached.wait(100));
+
+	// Ensure all streams were only executed once
+	QCOMPARE(cpFirst.count(), 1);
+	QCOMPARE(cpWrapped.count(), 1);
+	QCOMPARE(cpAttached.count(), 1);
+
+	// Ensure streams were awoken in the right order
+	QCOMPARE(awakeningOrder[0], QString("first"));
+	QCOMPARE(awakeningOrder[1], QString("wrapping"));
+	QCOMPARE(awakeningOrder[2], QString("wrapped"));
+	QCOMPARE(awakeningOrder[3], QString("attached"));
+
+	// Verify the data passed from the wrapped stream to the attached stream
+	QCOMPARE(passedData, QVariant("wrapped data"));
+}
@@ -0,0 +1,51 @@
+#include "QuickStreamsTest.hpp"
+#include <QQmlEngine>
+#include <QJSValue>
+
+// Measure the overhead of a JavaScript step by pushing a number
+// through a chain of JavaScript steps each incrementing it
+void QuickStreamsTest::benchmark_jsSteps() {
+	const int steps(200);
+	// The engine is deleted only once the streams it executes are destroyed
+	auto engine(new QQmlEngine);
+	auto provider(new qml::QmlProvider(engine, streams));
+	Trigger cpLast;
+	QQmlEngine::setObjectOwnership(&cpLast, QQmlEngine::CppOwnership);
+	QJSValue state(engine->newObject());
+
+	QJSValue build(engine->evaluate(
+		"(function(streams, cpLast, state, steps) {"
+		"	var stream = streams.create(function(stream, data) {"
+		"		stream.close(0)"
+		"	});"
+		"	for(var itr = 0; itr < steps; ++itr) {"
+		"		stream = stream.attach(function(data) { return data + 1 })"
+		"	}"
+		"	stream.attach(function(data) {"
+		"		state.result = data;"
+		"		cpLast.trigger()"
+		"	})"
+		"})"
+	));
+	QVERIFY(build.isCallable());
+
+	QBENCHMARK_ONCE {
+		build.call({
+			engine->newQObject(provider),
+			engine->newQObject(&cpLast),
+			state,
+			QJSValue(steps),
+		});
+		QVERIFY(cpLast.wait(5000));
+	}
+	QCOMPARE(state.property("result").toInt(), steps);
+
+	// Await next event loop cycle for deleteLater to destroy the streams
+	Trigger cleanup;
+	QTimer::singleShot(1, [&] {
+		cleanup.trigger();
+	});
+	QVERIFY(cleanup.wait(10));
+	QCOMPARE(streams->totalExisting(), quint64(0));
+	delete engine;
+}
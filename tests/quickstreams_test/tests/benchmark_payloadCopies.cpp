@@ -0,0 +1,57 @@
+#include "QuickStreamsTest.hpp"
+
+static int countedPayloadCopies(0);
+
+// A payload small and movable enough to be stored inside the variant,
+// thus copying the variant copies the payload and is counted
+struct CountedPayload {
+	int id;
+
+	CountedPayload(int id = 0) : id(id) {}
+	CountedPayload(const CountedPayload& other) : id(other.id) {
+		++countedPayloadCopies;
+	}
+	CountedPayload& operator=(const CountedPayload& other) {
+		id = other.id;
+		++countedPayloadCopies;
+		return *this;
+	}
+};
+Q_DECLARE_TYPEINFO(CountedPayload, Q_MOVABLE_TYPE);
+Q_DECLARE_METATYPE(CountedPayload)
+
+// Measure the number of copies of the data passed along a chain
+// of streams per hop. Each step returns the data it was awoken with
+// which copies it once, the data must not be copied any further
+// on its way from the closing stream to the executable of the next one
+void QuickStreamsTest::benchmark_payloadCopies() {
+	const int hops(100);
+	Trigger cpLast;
+	QVariant result;
+
+	auto stream = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		stream.close(QVariant::fromValue(CountedPayload(1)));
+	});
+	for(int itr(0); itr < hops; ++itr) {
+		stream = stream->attach([](const QVariant& data) {
+			return data;
+		});
+	}
+	stream->attach([&](const QVariant& data) {
+		result = data;
+		cpLast.trigger();
+		return QVariant();
+	});
+
+	countedPayloadCopies = 0;
+	QVERIFY(cpLast.wait(1000));
+
+	// The initial variant and the result each copy the payload once
+	const double copiesPerHop(double(countedPayloadCopies - 2) / hops);
+
+	QCOMPARE(result.value<CountedPayload>().id, 1);
+	QVERIFY(copiesPerHop <= 1.0);
+}
@@ -0,0 +1,63 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify an aborted combinator aborts its members and awakes
+// its abortion sequence once all members settled, and that a member
+// aborted from outside fails the combinator instead of stalling it
+void QuickStreamsTest::combinator_abort() {
+	Trigger cpAbortion;
+	Trigger cpCombined;
+	Trigger cpFailure;
+	int membersAborted(0);
+
+	auto createMember = [&]() {
+		return streams->create([&](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			QTimer::singleShot(40, [&, stream] {
+				if(stream.isAborted()) ++membersAborted;
+				stream.close();
+			});
+		}, Stream::Type::Abortable);
+	};
+
+	auto combined = streams->all({createMember(), createMember()});
+	combined->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpCombined.trigger();
+		return QVariant();
+	});
+	combined->abortion([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpAbortion.trigger();
+		return QVariant();
+	});
+	QTimer::singleShot(10, [combined] {
+		combined->abort();
+	});
+
+	QVERIFY(cpAbortion.wait(150));
+	QVERIFY(!cpCombined.wait(50));
+	QCOMPARE(cpAbortion.count(), 1);
+	QCOMPARE(membersAborted, 2);
+
+	// Abort a single member of another combinator from outside
+	auto aborted(createMember());
+	auto partial = streams->any({aborted});
+	partial->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpCombined.trigger();
+		return QVariant();
+	});
+	partial->failure([&](const QVariant& error) {
+		Q_UNUSED(error)
+		cpFailure.trigger();
+		return QVariant();
+	});
+	QTimer::singleShot(10, [aborted] {
+		aborted->abort();
+	});
+
+	QVERIFY(cpFailure.wait(150));
+	QCOMPARE(cpCombined.count(), 0);
+}
@@ -0,0 +1,38 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify the all combinator launches all streams concurrently
+// and closes with their close data in the order of the streams
+void QuickStreamsTest::combinator_all() {
+	Trigger cpCombined;
+	QVariant result;
+
+	// The first stream closes last to ensure the results are ordered
+	auto first = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		QTimer::singleShot(20, [stream, data] {
+			stream.close(data.toInt() + 1);
+		});
+	});
+	auto second = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		stream.close(data.toInt() + 2);
+	});
+
+	auto combined = streams->all({first, second});
+	combined->attach([&](const QVariant& data) {
+		result = data;
+		cpCombined.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpCombined.wait(100));
+	QCOMPARE(cpCombined.count(), 1);
+
+	// Combined streams are launched with the data of the combinator
+	auto results = result.toList();
+	QCOMPARE(results.size(), 2);
+	QCOMPARE(results[0].toInt(), 1);
+	QCOMPARE(results[1].toInt(), 2);
+}
@@ -0,0 +1,41 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify the any combinator ignores failed streams
+// and closes with the close data of the first stream to close
+void QuickStreamsTest::combinator_any() {
+	Trigger cpCombined;
+	Trigger cpFailure;
+	QVariant result;
+
+	auto failing = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		stream.fail(QString("failed"));
+	});
+	auto closing = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		QTimer::singleShot(10, [stream] {
+			stream.close("winner");
+		});
+	});
+
+	auto combined = streams->any({failing, closing});
+	combined->attach([&](const QVariant& data) {
+		result = data;
+		cpCombined.trigger();
+		return QVariant();
+	});
+	combined->failure([&](const QVariant& error) {
+		Q_UNUSED(error)
+		cpFailure.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpCombined.wait(100));
+	QVERIFY(!cpFailure.wait(50));
+	QCOMPARE(cpCombined.count(), 1);
+	QCOMPARE(result.toString(), QString("winner"));
+}
@@ -0,0 +1,23 @@
+#include "QuickStreamsTest.hpp"
+#include <stdexcept>
+
+// Verify streams capturing a sequence can't be combined
+// since the rest of their sequence would run unobserved
+void QuickStreamsTest::combinator_captured() {
+	auto head = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		stream.close(data);
+	});
+	head->attach([](const QVariant& data) {
+		return data;
+	});
+
+	auto other = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		stream.close(data);
+	});
+
+	QVERIFY_EXCEPTION_THROWN(streams->all({head, other}), std::logic_error);
+}
@@ -0,0 +1,45 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify the race combinator settles like the first stream to settle
+// and aborts the abortable streams that lost the race
+void QuickStreamsTest::combinator_race() {
+	Trigger cpCombined;
+	Trigger cpLoserSettled;
+	bool loserAborted(false);
+	QVariant result;
+
+	auto loser = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		QTimer::singleShot(50, [&, stream] {
+			loserAborted = stream.isAborted();
+			stream.close("loser");
+			cpLoserSettled.trigger();
+		});
+	}, Stream::Type::Abortable);
+
+	auto winner = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		stream.close("winner");
+	});
+
+	auto combined = streams->race({loser, winner});
+	combined->attach([&](const QVariant& data) {
+		result = data;
+		cpCombined.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpCombined.wait(100));
+	QCOMPARE(result.toString(), QString("winner"));
+
+	// The loser must be aborted and must not settle the race again
+	QVERIFY(cpLoserSettled.wait(100));
+	QVERIFY(loserAborted);
+	QVERIFY(!cpCombined.wait(50));
+	QCOMPARE(cpCombined.count(), 1);
+	QCOMPARE(result.toString(), QString("winner"));
+}
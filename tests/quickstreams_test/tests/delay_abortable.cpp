@@ -0,0 +1,45 @@
+#include "QuickStreamsTest.hpp"
+#include <QElapsedTimer>
+
+// Verify a delayed stream is awoken not before its delay is over
+// while an abortable stream aborted during its delay is never awoken
+void QuickStreamsTest::delay_abortable() {
+	Trigger cpDelayed;
+	Trigger cpAborted;
+	QElapsedTimer clock;
+	qint64 awokenAfter(0);
+
+	auto delayedStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		awokenAfter = clock.elapsed();
+		cpDelayed.trigger();
+		stream.close();
+	});
+	delayedStream->delay(30);
+
+	auto abortedStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		cpAborted.trigger();
+		stream.close();
+	}, Stream::Type::Abortable);
+	abortedStream->delay(30);
+
+	clock.start();
+
+	// Abort the abortable stream while it's awaiting its delay
+	QTimer::singleShot(10, [&] {
+		abortedStream->abort();
+	});
+
+	QVERIFY(cpDelayed.wait(100));
+	QVERIFY(!cpAborted.wait(60));
+
+	QVERIFY(awokenAfter >= 30);
+	QCOMPARE(cpDelayed.count(), 1);
+	QCOMPARE(cpAborted.count(), 0);
+	QCOMPARE(abortedStream->state(), Stream::State::Aborted);
+}
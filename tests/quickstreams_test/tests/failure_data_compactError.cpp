@@ -0,0 +1,82 @@
+#include "QuickStreamsTest.hpp"
+#include <system_error>
+#include <cerrno>
+#include <exception>
+#include <stdexcept>
+
+// Verify a compact error describes the thrown exception by its type,
+// message and code and creates the exception object only when accessed.
+// System errors of other than the system category keep their error code.
+// Compact errors only describe built-in and registered exception types
+void QuickStreamsTest::failure_data_compactError() {
+	Trigger cpFailure;
+
+	Error receivedError;
+
+	auto createdStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		throw std::system_error(
+			std::make_error_code(std::errc::timed_out),
+			"connection lost"
+		);
+		stream.close();
+	});
+
+	createdStream->failure([&](const QVariant& error) {
+		receivedError = error.value<Error>();
+		cpFailure.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpFailure.wait(100));
+
+	// Ensure the error is inspectable by its type, message and code
+	QVERIFY(!receivedError.isNull());
+	QVERIFY(receivedError.is(exception::SystemError::type()));
+	QVERIFY(receivedError.message().contains("connection lost"));
+	QCOMPARE(receivedError.code(), qint64(int(std::errc::timed_out)));
+
+	auto exception(receivedError.as<exception::SystemError>());
+	QCOMPARE(exception->message(), receivedError.message());
+	QCOMPARE(exception->code().value(), int(std::errc::timed_out));
+
+	// Ensure the category of the original error code is preserved
+	QVERIFY(exception->code().category() == std::generic_category());
+
+	// Ensure errors of the system category are restored from their code
+	Error denied(streams->exceptionTranslator()->translate(
+		std::make_exception_ptr(std::system_error(
+			EACCES, std::system_category(), "denied"
+		))
+	));
+	QCOMPARE(denied.code(), qint64(EACCES));
+	QVERIFY(
+		denied.as<exception::SystemError>()->code()
+		== std::error_code(EACCES, std::system_category())
+	);
+
+	// Ensure compact errors created directly materialize their details
+	Error timeout(exception::TimeoutError::type(), "too slow", 250);
+	QCOMPARE(timeout.as<exception::TimeoutError>()->duration(), 250);
+	Error circuitOpen(
+		exception::CircuitOpenError::type(), "circuit is open", 0, "storage"
+	);
+	QVERIFY(circuitOpen.is(exception::CircuitOpenError::type()));
+	QCOMPARE(
+		circuitOpen.as<exception::CircuitOpenError>()->breaker(),
+		QString("storage")
+	);
+	QVERIFY(Error().isNull());
+
+	// Ensure exception objects aren't cast to mismatching types
+	QVERIFY(timeout.as<exception::RuntimeError>() != nullptr);
+	QVERIFY(timeout.as<exception::CircuitOpenError>() == nullptr);
+
+	// Ensure compact errors can't describe types that aren't exceptions
+	QVERIFY_EXCEPTION_THROWN(
+		Error(QMetaType::QString, "not an exception"),
+		std::logic_error
+	);
+}
@@ -0,0 +1,57 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify a failure stream registered on a separately built sequence
+// is overridden by the failure stream of the sequence it's attached to
+// and the failure of any member awakes the remaining failure stream
+void QuickStreamsTest::failure_joinedSequence() {
+	Trigger cpHead;
+	Trigger cpFailure_overridden;
+	Trigger cpFailure_actual;
+
+	auto head = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		cpHead.trigger();
+		stream.close();
+	});
+	auto headTail = head->attach([](const QVariant& data) {
+		return data;
+	});
+	auto failureStream1 = headTail->failure([&](const QVariant& error) {
+		Q_UNUSED(error)
+		cpFailure_actual.trigger();
+		return QVariant();
+	});
+
+	// Build another sequence failing at its tail
+	auto tail = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		stream.close(data);
+	});
+	auto failingStream = tail->attach([](const QVariant& data) {
+		Q_UNUSED(data)
+		throw std::runtime_error("something went wrong");
+		return QVariant();
+	});
+	auto failureStream2 = failingStream->failure([&](const QVariant& error) {
+		Q_UNUSED(error)
+		cpFailure_overridden.trigger();
+		return QVariant();
+	});
+
+	// Join both sequences
+	headTail->attach(tail);
+
+	Q_UNUSED(failureStream1)
+	Q_UNUSED(failureStream2)
+
+	QVERIFY(cpHead.wait(100));
+	QVERIFY(cpFailure_actual.wait(100));
+	QVERIFY(!cpFailure_overridden.wait(100));
+
+	QCOMPARE(cpHead.count(), 1);
+	QCOMPARE(cpFailure_actual.count(), 1);
+	QCOMPARE(cpFailure_overridden.count(), 0);
+}
@@ -0,0 +1,54 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify streams guarded by a shared circuit breaker fail fast
+// while it's open and that a successful probe closes it again
+void QuickStreamsTest::guard_circuitBreaker() {
+	Trigger cpFailed;
+	Trigger cpExecuted;
+	int rejections(0);
+
+	auto breaker(streams->circuitBreaker(
+		"storage", CircuitBreaker::Policy(4, 0.5, 50, 1, 2)
+	));
+
+	auto createGuarded([&](bool fail) {
+		auto stream = streams->create([&, fail](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			cpExecuted.trigger();
+			if(fail) throw std::runtime_error("storage unavailable");
+			stream.close();
+		});
+		stream->guard("storage");
+		stream->failure([&](const QVariant& error) {
+			if(error.value<Error>().is(exception::CircuitOpenError::type())) {
+				++rejections;
+			}
+			cpFailed.trigger();
+			return QVariant();
+		});
+		return stream;
+	});
+
+	// Two failures within the window open the breaker
+	createGuarded(true);
+	createGuarded(true);
+	while(cpFailed.count() < 2 && cpFailed.wait(100)) {}
+	QCOMPARE(cpExecuted.count(), 2);
+	QCOMPARE(breaker->state(), CircuitBreaker::State::Open);
+
+	// While open the guarded stream fails fast without being executed
+	createGuarded(false);
+	QVERIFY(cpFailed.wait(100));
+	QCOMPARE(rejections, 1);
+	QCOMPARE(cpExecuted.count(), 2);
+
+	// After the open duration a successful probe closes the breaker
+	QTest::qWait(60);
+	QCOMPARE(breaker->state(), CircuitBreaker::State::HalfOpen);
+	createGuarded(false);
+	QVERIFY(cpExecuted.wait(100));
+	QCOMPARE(breaker->state(), CircuitBreaker::State::Closed);
+	QCOMPARE(cpFailed.count(), 3);
+}
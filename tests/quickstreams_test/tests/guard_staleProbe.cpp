@@ -0,0 +1,37 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify a probe released after the breaker opened again
+// doesn't affect the probes of the following half-open period
+void QuickStreamsTest::guard_staleProbe() {
+	// Open on the first failure and turn half-open right away
+	// letting two probes through
+	CircuitBreaker breaker("stale", CircuitBreaker::Policy(1, 0.5, 0, 2, 1));
+
+	breaker.release(breaker.acquire(), CircuitBreaker::Outcome::Failure);
+	QVERIFY(breaker.state() == CircuitBreaker::State::HalfOpen);
+
+	// The second probe fails opening the breaker again
+	// while the first one is still running
+	auto stale(breaker.acquire());
+	auto failing(breaker.acquire());
+	QVERIFY(stale.kind == CircuitBreaker::Permit::Kind::Probe);
+	QVERIFY(failing.kind == CircuitBreaker::Permit::Kind::Probe);
+	breaker.release(failing, CircuitBreaker::Outcome::Failure);
+	QVERIFY(breaker.state() == CircuitBreaker::State::HalfOpen);
+
+	// The stale probe succeeds during the next half-open period
+	auto first(breaker.acquire());
+	QVERIFY(first.kind == CircuitBreaker::Permit::Kind::Probe);
+	breaker.release(stale, CircuitBreaker::Outcome::Success);
+
+	// Ensure only the probes of the current period close the breaker
+	auto second(breaker.acquire());
+	QVERIFY(second.kind == CircuitBreaker::Permit::Kind::Probe);
+	QVERIFY(
+		breaker.acquire().kind == CircuitBreaker::Permit::Kind::Rejected
+	);
+	breaker.release(first, CircuitBreaker::Outcome::Success);
+	QVERIFY(breaker.state() == CircuitBreaker::State::HalfOpen);
+	breaker.release(second, CircuitBreaker::Outcome::Success);
+	QVERIFY(breaker.state() == CircuitBreaker::State::Closed);
+}
@@ -0,0 +1,58 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify a copied stream handle can safely be used
+// after the stream it refers to was destroyed
+void QuickStreamsTest::handle_afterDestruction() {
+	Trigger cpClosed;
+	StreamHandle handle;
+	QVERIFY(!handle.isValid());
+
+	auto stream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		// Keep a copy of the handle beyond the lifetime of the stream
+		handle = stream;
+		stream.close();
+	});
+	stream->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpClosed.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpClosed.wait(50));
+	QVERIFY(handle.isValid());
+
+	stream.clear();
+
+	// Await next event loop cycle for deleteLater to destroy the streams
+	Trigger cleanup;
+	QTimer::singleShot(1, [&] {
+		cleanup.trigger();
+	});
+	QVERIFY(cleanup.wait(1));
+	QCOMPARE(streams->totalExisting(), quint64(0));
+
+	// A new stream reusing the released slot must not be reachable
+	// through the handle of the destroyed stream
+	Trigger cpOther;
+	auto other = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(stream)
+		Q_UNUSED(data)
+		cpOther.trigger();
+	});
+	QVERIFY(cpOther.wait(50));
+
+	// All calls through the invalidated handle are ignored
+	QVERIFY(!handle.isValid());
+	QVERIFY(!handle.isAbortable());
+	QVERIFY(!handle.isAborted());
+	handle.event("ignored");
+	handle.close();
+	handle.fail();
+	QCOMPARE(cpClosed.count(), 1);
+	QCOMPARE(cpOther.count(), 1);
+}
@@ -0,0 +1,48 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify aborting a hedge stream aborts all attempts in flight
+// and awakes its abortion sequence once they settled
+void QuickStreamsTest::hedge_abort() {
+	Trigger cpAbortion;
+	Trigger cpHedged;
+	int attempts(0);
+	int aborted(0);
+
+	auto policy(HedgePolicy::Reference(new HedgePolicy(0.95, 10)));
+
+	auto hedged = streams->hedge([&](const QVariant& data) {
+		Q_UNUSED(data)
+		++attempts;
+		return streams->create([&](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			QTimer::singleShot(60, [&, stream] {
+				if(stream.isAborted()) ++aborted;
+				stream.close();
+			});
+		}, Stream::Type::Abortable);
+	}, policy, 2);
+
+	hedged->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpHedged.trigger();
+		return QVariant();
+	});
+	hedged->abortion([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpAbortion.trigger();
+		return QVariant();
+	});
+
+	// Abort after the duplicate attempt was launched
+	QTimer::singleShot(30, [hedged] {
+		hedged->abort();
+	});
+
+	QVERIFY(cpAbortion.wait(200));
+	QVERIFY(!cpHedged.wait(50));
+	QCOMPARE(cpAbortion.count(), 1);
+	QCOMPARE(attempts, 2);
+	QCOMPARE(aborted, 2);
+}
@@ -0,0 +1,44 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify hedge launches a duplicate attempt when the first one doesn't
+// settle within the threshold, closes with the data of the faster attempt
+// and disposes the slower one
+void QuickStreamsTest::hedge_slowAttempt() {
+	Trigger cpHedged;
+	int attempts(0);
+	Stream::Reference slowAttempt;
+	QVariant result;
+
+	auto policy(HedgePolicy::Reference(new HedgePolicy(0.95, 20)));
+
+	auto hedged = streams->hedge([&](const QVariant& data) {
+		Q_UNUSED(data)
+		const int attempt(++attempts);
+		auto stream = streams->create([attempt](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			// The first attempt is slow, the duplicate is fast
+			QTimer::singleShot(attempt < 2 ? 100 : 10, [stream, attempt] {
+				stream.close(attempt);
+			});
+		}, Stream::Type::Abortable);
+		if(attempt < 2) slowAttempt = stream;
+		return stream;
+	}, policy);
+
+	hedged->attach([&](const QVariant& data) {
+		result = data;
+		cpHedged.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpHedged.wait(100));
+	QVERIFY(!cpHedged.wait(150));
+
+	QCOMPARE(attempts, 2);
+	QCOMPARE(result.toInt(), 2);
+	QCOMPARE(cpHedged.count(), 1);
+	QCOMPARE(slowAttempt->state(), Stream::State::Dead);
+	QCOMPARE(policy->samples(), 1);
+}
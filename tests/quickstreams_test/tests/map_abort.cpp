@@ -0,0 +1,51 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify aborting mapConcurrent mid-flight aborts the streams in flight,
+// launches no further streams and awakes the abortion sequence
+// once the streams in flight settled
+void QuickStreamsTest::map_abort() {
+	Trigger cpAbortion;
+	Trigger cpMapped;
+	int launched(0);
+	int aborted(0);
+	const quint64 activeBefore(streams->totalActive());
+
+	auto mapped = streams->mapConcurrent({1, 2, 3, 4, 5, 6}, [&](
+		const QVariant& item
+	) {
+		Q_UNUSED(item)
+		return streams->create([&](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			++launched;
+			QTimer::singleShot(40, [&, stream] {
+				if(stream.isAborted()) ++aborted;
+				stream.close();
+			});
+		}, Stream::Type::Abortable);
+	}, 2);
+
+	mapped->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpMapped.trigger();
+		return QVariant();
+	});
+	mapped->abortion([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpAbortion.trigger();
+		return QVariant();
+	});
+	QTimer::singleShot(10, [mapped] {
+		mapped->abort();
+	});
+
+	QVERIFY(cpAbortion.wait(150));
+	QVERIFY(!cpMapped.wait(50));
+	QCOMPARE(cpAbortion.count(), 1);
+	QCOMPARE(launched, 2);
+	QCOMPARE(aborted, 2);
+
+	// The map stream must no longer be active
+	QCOMPARE(streams->totalActive(), activeBefore);
+}
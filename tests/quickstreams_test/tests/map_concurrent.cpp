@@ -0,0 +1,44 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify mapConcurrent processes all items keeping no more than
+// the given number of streams in flight and preserves the item order
+void QuickStreamsTest::map_concurrent() {
+	Trigger cpMapped;
+	QVariant result;
+	int inFlight(0);
+	int maxInFlight(0);
+
+	auto mapped = streams->mapConcurrent({1, 2, 3, 4, 5, 6}, [&](
+		const QVariant& item
+	) {
+		return streams->create([&, item](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			++inFlight;
+			if(inFlight > maxInFlight) maxInFlight = inFlight;
+
+			// Later items complete sooner to verify the result order
+			QTimer::singleShot(10 - item.toInt(), [&, stream, item] {
+				--inFlight;
+				stream.close(item.toInt() * 10);
+			});
+		});
+	}, 2);
+
+	mapped->attach([&](const QVariant& data) {
+		result = data;
+		cpMapped.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpMapped.wait(200));
+	QCOMPARE(cpMapped.count(), 1);
+	QCOMPARE(maxInFlight, 2);
+
+	auto results = result.toList();
+	QCOMPARE(results.size(), 6);
+	for(int itr(0); itr < results.size(); ++itr) {
+		QCOMPARE(results[itr].toInt(), (itr + 1) * 10);
+	}
+}
@@ -0,0 +1,34 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify mapConcurrent processes many items settling synchronously
+// within their launch without recursing once per item
+void QuickStreamsTest::map_synchronous() {
+	Trigger cpMapped;
+	QVariant result;
+
+	const int count(100000);
+	QVariantList items;
+	for(int itr(0); itr < count; ++itr) items.append(itr);
+
+	// Most items pass through unchanged without any stream,
+	// settling within the launch of the map
+	auto mapped = streams->mapConcurrent(items, [&](const QVariant& item) {
+		if(item.toInt() % 1000) return Stream::Reference();
+		return streams->create([](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			stream.close(data);
+		});
+	}, 2);
+
+	mapped->attach([&](const QVariant& data) {
+		result = data;
+		cpMapped.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpMapped.wait(5000));
+	auto results = result.toList();
+	QCOMPARE(results.size(), count);
+	QCOMPARE(results.last().toInt(), count - 1);
+}
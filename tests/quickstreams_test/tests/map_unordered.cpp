@@ -0,0 +1,37 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify unordered mapConcurrent collects the results
+// in the order the streams closed in
+void QuickStreamsTest::map_unordered() {
+	Trigger cpMapped;
+	QVariant result;
+
+	auto mapped = streams->mapConcurrent({1, 2, 3}, [&](
+		const QVariant& item
+	) {
+		return streams->create([item](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			// Later items complete sooner
+			QTimer::singleShot(40 - item.toInt() * 10, [stream, item] {
+				stream.close(item.toInt() * 10);
+			});
+		});
+	}, 3, false);
+
+	mapped->attach([&](const QVariant& data) {
+		result = data;
+		cpMapped.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpMapped.wait(200));
+	QCOMPARE(cpMapped.count(), 1);
+
+	auto results = result.toList();
+	QCOMPARE(results.size(), 3);
+	QCOMPARE(results[0].toInt(), 30);
+	QCOMPARE(results[1].toInt(), 20);
+	QCOMPARE(results[2].toInt(), 10);
+}
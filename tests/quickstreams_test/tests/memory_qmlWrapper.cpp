@@ -0,0 +1,45 @@
+#include "QuickStreamsTest.hpp"
+#include <QQmlEngine>
+#include <QPointer>
+#include <QWeakPointer>
+
+// Verify each stream is wrapped by a single QML wrapper
+// which doesn't keep the stream alive after it died
+void QuickStreamsTest::memory_qmlWrapper() {
+	// Just like the providers the engine is never deleted because
+	// the executables of the streams may outlive this test function
+	auto engine(new QQmlEngine);
+	auto provider(new qml::QmlProvider(engine, streams));
+	Trigger cpClosed;
+
+	auto stream(streams->create([&](
+		const StreamHandle& handle, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		handle.close();
+	}));
+	stream->attach([&](const QVariant& data) {
+		cpClosed.trigger();
+		return data;
+	});
+
+	// Wrapping the same stream twice must return the same wrapper
+	QPointer<qml::QmlStream> wrapper(provider->toQml(stream));
+	QVERIFY(!wrapper.isNull());
+	QCOMPARE(provider->toQml(stream), wrapper.data());
+
+	QWeakPointer<Stream> weak(stream);
+	stream.clear();
+
+	QVERIFY(cpClosed.wait(100));
+	QTest::qWait(10);
+
+	// The wrapper is still alive but must no longer keep
+	// the dead stream alive, operators on it are ignored
+	QVERIFY(weak.isNull());
+	QVERIFY(!wrapper.isNull());
+	QCOMPARE(wrapper->delay(QJSValue(10)), wrapper.data());
+	QVERIFY(!wrapper->isAborted());
+
+	delete wrapper.data();
+}
@@ -0,0 +1,65 @@
+#include "QuickStreamsTest.hpp"
+#include <QAtomicInteger>
+
+// Verify an offloaded stream is never executed concurrently
+// when its trial is settled before the executable returned
+// either by a timeout or by failing through the handle
+void QuickStreamsTest::offload_timeoutRetry() {
+	streams->setScheduler(Scheduler::Reference(new SharedQueueScheduler(2)));
+
+	Trigger cpAttached;
+	Trigger cpFailure;
+	QAtomicInteger<int> trials(0);
+	QAtomicInteger<int> running(0);
+	QAtomicInteger<int> overlaps(0);
+	QVariant passedData;
+
+	auto stream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		if(running.fetchAndAddOrdered(1) > 0) overlaps.fetchAndAddOrdered(1);
+		const int trial(trials.fetchAndAddOrdered(1) + 1);
+		switch(trial) {
+		case 1:
+			// Get stuck past the timeout
+			QThread::msleep(60);
+			break;
+		case 2:
+			// Fail through the handle but keep executing for a while
+			stream.fail(QVariant::fromValue<Error>(
+				Error(exception::RuntimeError::type(), "busy")
+			));
+			QThread::msleep(30);
+			break;
+		default:
+			stream.close(trial);
+			break;
+		}
+		running.fetchAndAddOrdered(-1);
+	});
+	stream->offload()->timeout(20)->retry({
+		exception::TimeoutError::type(),
+		exception::RuntimeError::type()
+	}, 2);
+
+	stream->attach([&](const QVariant& data) {
+		passedData = data;
+		cpAttached.trigger();
+		return QVariant();
+	});
+	stream->failure([&](const QVariant& error) {
+		Q_UNUSED(error)
+		cpFailure.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpAttached.wait(500));
+	QVERIFY(!cpFailure.wait(50));
+
+	// Ensure each retrial waited for the previous execution to return
+	QCOMPARE(trials.load(), 3);
+	QCOMPARE(overlaps.load(), 0);
+	QCOMPARE(cpAttached.count(), 1);
+	QCOMPARE(passedData.toInt(), 3);
+}
@@ -0,0 +1,36 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify many offloaded streams fanned out across the workers
+// of a work stealing scheduler are all executed exactly once
+void QuickStreamsTest::offload_workStealing() {
+	auto scheduler = Scheduler::create(Scheduler::Policy::WorkStealing, 4);
+	streams->setScheduler(scheduler);
+	QCOMPARE(scheduler->workers(), 4);
+
+	const int total(64);
+	Trigger cpClosed;
+	int sum(0);
+
+	for(int itr(0); itr < total; ++itr) {
+		streams->create([itr](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			stream.close(itr);
+		})->offload()->attach([&](const QVariant& data) {
+			sum += data.toInt();
+			cpClosed.trigger();
+			return QVariant();
+		});
+	}
+
+	// Await all continuations which may complete in the same cycle
+	while(cpClosed.count() < total && cpClosed.wait(500)) {}
+	QCOMPARE(cpClosed.count(), total);
+	QCOMPARE(sum, total * (total - 1) / 2);
+
+	// Every task was either popped locally or stolen
+	auto statistics = scheduler->statistics();
+	QCOMPARE(statistics.executed, quint64(total));
+	QCOMPARE(statistics.localPops + statistics.steals, quint64(total));
+}
@@ -0,0 +1,38 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify an offloaded stream executes its executable on a worker thread
+// while the continuation of the sequence remains on the provider thread
+void QuickStreamsTest::offload_workerThread() {
+	streams->setScheduler(Scheduler::Reference(new SharedQueueScheduler(2)));
+
+	Trigger cpLast;
+	QThread* offloadedThread(nullptr);
+	QThread* continuationThread(nullptr);
+	QVariant result;
+
+	auto stream = streams->create([](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		stream.close(20);
+	});
+
+	stream->attach([&](const QVariant& data) {
+		offloadedThread = QThread::currentThread();
+		return QVariant(data.toInt() + 1);
+	})->offload()->attach([&](const QVariant& data) {
+		continuationThread = QThread::currentThread();
+		result = data;
+		cpLast.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpLast.wait(500));
+	QCOMPARE(cpLast.count(), 1);
+
+	// Ensure only the offloaded executable was executed on a worker thread
+	QVERIFY(offloadedThread != nullptr);
+	QVERIFY(offloadedThread != QThread::currentThread());
+	QCOMPARE(continuationThread, QThread::currentThread());
+	QCOMPARE(result.toInt(), 21);
+}
@@ -0,0 +1,51 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify a sequence is executed properly and in the right order
+// when the provider dispatches only one transition per event loop cycle
+void QuickStreamsTest::provider_dispatchBudget() {
+	streams->setDispatchBudget(1);
+	QCOMPARE(streams->dispatchBudget(), 1);
+
+	Trigger cpLast;
+	QList<int> awakeningOrder;
+
+	auto stream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		awakeningOrder.append(0);
+		stream.close(1);
+	});
+
+	// Build a long sequence passing an incremented counter along
+	auto last = stream;
+	for(int itr(1); itr < 64; ++itr) {
+		last = last->attach([&](const QVariant& data) {
+			awakeningOrder.append(data.toInt());
+			return QVariant(data.toInt() + 1);
+		});
+	}
+	last->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpLast.trigger();
+		return QVariant();
+	});
+
+	// A concurrent free stream must not be starved by the long sequence
+	Trigger cpConcurrent;
+	streams->create([&](const StreamHandle& stream, const QVariant& data) {
+		Q_UNUSED(data)
+		cpConcurrent.trigger();
+		stream.close();
+	});
+
+	QVERIFY(cpConcurrent.wait(100));
+	QVERIFY(cpLast.wait(500));
+	QCOMPARE(cpLast.count(), 1);
+
+	// Ensure streams were awoken in the right order
+	QCOMPARE(awakeningOrder.size(), 64);
+	for(int itr(0); itr < awakeningOrder.size(); ++itr) {
+		QCOMPARE(awakeningOrder[itr], itr);
+	}
+}
@@ -0,0 +1,35 @@
+#include "QuickStreamsTest.hpp"
+#include <QThread>
+#include <QVector>
+
+class CountingThread : public QThread {
+protected:
+	ShardedCounter* _counter;
+
+	void run() {
+		for(int itr(0); itr < 10000; ++itr) _counter->increment();
+		for(int itr(0); itr < 4000; ++itr) _counter->decrement();
+	}
+
+public:
+	CountingThread(ShardedCounter* counter) : _counter(counter) {}
+};
+
+// Verify the sharded counter backing the provider statistics
+// remains exact when updated concurrently from multiple threads
+void QuickStreamsTest::provider_shardedCounter() {
+	ShardedCounter counter;
+	QVector<CountingThread*> threads;
+	for(int itr(0); itr < 8; ++itr) {
+		threads.append(new CountingThread(&counter));
+	}
+
+	// The provider thread decrements what others incremented
+	for(int itr(0); itr < 1000; ++itr) counter.increment();
+	for(auto thread : threads) thread->start();
+	for(int itr(0); itr < 500; ++itr) counter.decrement();
+	for(auto thread : threads) QVERIFY(thread->wait(5000));
+	qDeleteAll(threads);
+
+	QCOMPARE(counter.load(), quint64(8 * 6000 + 500));
+}
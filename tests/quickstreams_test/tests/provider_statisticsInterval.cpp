@@ -0,0 +1,59 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify the statistics change signals are coalesced
+// into a single notification per event loop cycle
+// while the counters remain exact
+void QuickStreamsTest::provider_statisticsInterval() {
+	streams->setStatisticsInterval(0);
+	QCOMPARE(streams->statisticsInterval(), 0);
+
+	int createdNotifications(0);
+	int activeNotifications(0);
+	connect(streams, &Provider::totalCreatedChanged, [&]() {
+		++createdNotifications;
+	});
+	connect(streams, &Provider::totalActiveChanged, [&]() {
+		++activeNotifications;
+	});
+
+	Trigger cpClosed;
+	for(int itr(0); itr < 64; ++itr) {
+		streams->create([&](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			stream.close();
+			cpClosed.trigger();
+		});
+	}
+
+	// The counters are exact before anything was notified
+	QCOMPARE(streams->totalCreated(), quint64(64));
+	QCOMPARE(createdNotifications, 0);
+
+	while(cpClosed.count() < 64 && cpClosed.wait(100)) {}
+	QCOMPARE(cpClosed.count(), 64);
+	QTest::qWait(10);
+
+	// All creations were notified at once
+	QCOMPARE(createdNotifications, 1);
+
+	// All streams were activated and finished in the same cycle
+	// thus the active counter hasn't changed by the time it's notified
+	QCOMPARE(streams->totalActive(), quint64(0));
+	QVERIFY(activeNotifications <= 1);
+
+	// A positive interval notifies at most once per interval
+	streams->setStatisticsInterval(50);
+	for(int itr(0); itr < 16; ++itr) {
+		streams->create([](const StreamHandle& stream, const QVariant& data) {
+			Q_UNUSED(data)
+			stream.close();
+		});
+		QTest::qWait(1);
+	}
+	QCOMPARE(streams->totalCreated(), quint64(80));
+	QTest::qWait(100);
+	QVERIFY(createdNotifications >= 2);
+	QVERIFY(createdNotifications < 1 + 16);
+}
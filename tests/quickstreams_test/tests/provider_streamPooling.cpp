@@ -0,0 +1,69 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify streams are allocated in the pool when pooling is enabled
+// and the memory of destroyed streams is recycled for new streams
+void QuickStreamsTest::provider_streamPooling() {
+	QCOMPARE(streams->streamPooling(), false);
+	streams->setStreamPooling(true);
+	QCOMPARE(streams->streamPooling(), true);
+
+	Trigger cpFirst;
+	Trigger cpSecond;
+
+	auto firstStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		stream.close();
+		cpFirst.trigger();
+	});
+
+	auto secondStream = firstStream->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpSecond.trigger();
+		return QVariant();
+	});
+
+	// Only the first allocation required a new slab
+	QCOMPARE(streams->poolMisses(), quint64(1));
+	QCOMPARE(streams->poolHits(), quint64(1));
+
+	QVERIFY(cpFirst.wait(50));
+	QVERIFY(cpSecond.wait(50));
+
+	const Stream* firstAddress(firstStream.data());
+	const Stream* secondAddress(secondStream.data());
+	firstStream.clear();
+	secondStream.clear();
+
+	// Await next event loop cycle for deleteLater to destroy the streams
+	Trigger cleanup;
+	QTimer::singleShot(1, [&] {
+		cleanup.trigger();
+	});
+	QVERIFY(cleanup.wait(1));
+	QCOMPARE(streams->totalExisting(), quint64(0));
+
+	// A new stream must reuse recycled memory
+	Trigger cpThird;
+	auto thirdStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		stream.close();
+		cpThird.trigger();
+	});
+	QCOMPARE(streams->poolMisses(), quint64(1));
+	QCOMPARE(streams->poolHits(), quint64(2));
+
+	// The new stream occupies the memory of a destroyed one
+	QVERIFY(
+		thirdStream.data() == firstAddress
+		|| thirdStream.data() == secondAddress
+	);
+
+	QVERIFY(cpThird.wait(50));
+	QCOMPARE(cpFirst.count(), 1);
+	QCOMPARE(cpSecond.count(), 1);
+	QCOMPARE(cpThird.count(), 1);
+}
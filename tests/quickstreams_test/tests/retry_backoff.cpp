@@ -0,0 +1,57 @@
+#include "QuickStreamsTest.hpp"
+#include <QElapsedTimer>
+
+// Verify the retry operator backs off for an exponentially growing delay
+// before each retrial when retrying with a backoff policy
+void QuickStreamsTest::retry_backoff() {
+	Trigger cpFailing;
+	Trigger cpSecond;
+	Trigger cpFailure;
+	QElapsedTimer clock;
+	QList<qint64> trials;
+
+	auto failingStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		trials.append(clock.elapsed());
+		cpFailing.trigger();
+		// Commit failure for 2 times here
+		if(trials.size() < 3) throw std::runtime_error("failure");
+		stream.close();
+	});
+
+	failingStream->retry(
+		{exception::RuntimeError::type()},
+		BackoffRetryer::Policy(20, 1000, BackoffRetryer::Jitter::None),
+		2
+	);
+
+	failingStream->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpSecond.trigger();
+		return QVariant();
+	});
+
+	failingStream->failure([&](const QVariant& error) {
+		Q_UNUSED(error)
+		cpFailure.trigger();
+		return QVariant();
+	});
+
+	clock.start();
+
+	// Verify the initial trial and both retrials
+	QVERIFY(cpFailing.wait(100));
+	QVERIFY(cpFailing.wait(100));
+	QVERIFY(cpFailing.wait(100));
+	QVERIFY(cpSecond.wait(100));
+	QVERIFY(!cpFailure.wait(50));
+
+	// The first retrial backs off for 20 and the second for 40 milliseconds
+	QCOMPARE(trials.size(), 3);
+	QVERIFY(trials[1] - trials[0] >= 20);
+	QVERIFY(trials[2] - trials[1] >= 40);
+	QCOMPARE(cpSecond.count(), 1);
+	QCOMPARE(cpFailure.count(), 0);
+}
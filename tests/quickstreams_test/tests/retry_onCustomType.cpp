@@ -0,0 +1,106 @@
+#include "QuickStreamsTest.hpp"
+#include "CustomErrors.hpp"
+#include <stdexcept>
+
+// A custom domain error retried by its type
+class QuotaExceeded : public std::runtime_error {
+public:
+	QuotaExceeded() : std::runtime_error("quota exceeded") {}
+};
+
+// A custom error not derived from std::exception
+struct ServiceUnavailable {
+	int status;
+};
+
+// Verify custom exception types translated by the exception translator
+// of the provider drive the type-retry operator and materialize
+// as their registered exception classes
+void QuickStreamsTest::retry_onCustomType() {
+	// Translations into unregistered types are rejected
+	QVERIFY_EXCEPTION_THROWN(
+		streams->exceptionTranslator()->add<QuotaExceeded>(QMetaType::QString),
+		std::logic_error
+	);
+
+	const int serviceUnavailableType(
+		Error::registerType<ServiceUnavailableError>()
+	);
+	streams->exceptionTranslator()->add<QuotaExceeded, QuotaExceededError>();
+	streams->exceptionTranslator()->add<ServiceUnavailable>([=](
+		const ServiceUnavailable& error
+	) {
+		return Error(serviceUnavailableType, "service unavailable", error.status);
+	});
+	const int quotaExceededType(qMetaTypeId<QuotaExceededError*>());
+
+	// A translation of the base type added later doesn't override
+	// the translation of the more derived custom type
+	streams->exceptionTranslator()->add<std::runtime_error>(
+		exception::RuntimeError::type()
+	);
+
+	Trigger cpFailing;
+	Trigger cpSecond;
+	Trigger cpFailure;
+	int counter(0);
+	QList<int> errorTypes;
+
+	auto failingStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		cpFailing.trigger();
+		++counter;
+		switch(counter) {
+		case 1: throw QuotaExceeded();
+		case 2: throw ServiceUnavailable{503};
+		case 3: throw std::runtime_error("not retried");
+		default: break;
+		}
+		stream.close();
+	});
+
+	failingStream->retry(
+		TypeRetryer::TypeList{quotaExceededType, serviceUnavailableType}, 5
+	);
+
+	failingStream->attach([&](const QVariant& data) {
+		Q_UNUSED(data)
+		cpSecond.trigger();
+		return QVariant();
+	});
+
+	failingStream->failure([&](const QVariant& error) {
+		errorTypes.append(error.value<Error>().type());
+		cpFailure.trigger();
+		return QVariant();
+	});
+
+	// Both custom errors are retried, the standard one fails the stream
+	while(cpFailing.count() < 3 && cpFailing.wait(100)) {}
+	QCOMPARE(cpFailing.count(), 3);
+	if(cpFailure.count() < 1) QVERIFY(cpFailure.wait(100));
+	QVERIFY(!cpSecond.wait(50));
+	QCOMPARE(errorTypes.size(), 1);
+	QCOMPARE(errorTypes.first(), exception::RuntimeError::type());
+
+	// Ensure translated custom errors materialize as their exception class
+	Error quota(streams->exceptionTranslator()->translate(
+		std::make_exception_ptr(QuotaExceeded())
+	));
+	QCOMPARE(quota.type(), quotaExceededType);
+	QCOMPARE(quota->message(), QString("quota exceeded"));
+	QVERIFY(quota.as<QuotaExceededError>() != nullptr);
+	QVERIFY(quota.as<exception::RuntimeError>() != nullptr);
+	QVERIFY(quota.as<ServiceUnavailableError>() == nullptr);
+
+	Error unavailable(streams->exceptionTranslator()->translate(
+		std::make_exception_ptr(ServiceUnavailable{503})
+	));
+	QCOMPARE(unavailable.code(), qint64(503));
+	QCOMPARE(
+		unavailable.as<ServiceUnavailableError>()->message(),
+		QString("service unavailable")
+	);
+}
@@ -0,0 +1,51 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify the type-retry operator retries errors of descendant types
+// of the given types but not errors of their sibling types
+void QuickStreamsTest::retry_onType_hierarchy() {
+	// Ensure the matcher honors the exception type hierarchy
+	ErrorMatcher matcher({exception::RuntimeError::type()});
+	QVERIFY(matcher.matches(exception::RuntimeError::type()));
+	QVERIFY(matcher.matches(exception::OverflowError::type()));
+	QVERIFY(matcher.matches(exception::TimeoutError::type()));
+	QVERIFY(!matcher.matches(exception::Exception::type()));
+	QVERIFY(!matcher.matches(exception::LogicError::type()));
+	QVERIFY(!matcher.matches(exception::OutOfRange::type()));
+	QVERIFY(ErrorMatcher({exception::Exception::type()}).matches(
+		exception::BadArrayNewLength::type()
+	));
+
+	Trigger cpFailing;
+	Trigger cpFailure;
+	int counter(0);
+	int failedType(QMetaType::Void);
+
+	auto failingStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		cpFailing.trigger();
+		++counter;
+		switch(counter) {
+		case 1: throw std::overflow_error("first error");
+		case 2: throw std::range_error("second error");
+		default: throw std::out_of_range("third error");
+		}
+		stream.close();
+	});
+
+	failingStream->retry({exception::RuntimeError::type()}, 5);
+
+	failingStream->failure([&](const QVariant& error) {
+		failedType = error.value<Error>().type();
+		cpFailure.trigger();
+		return QVariant();
+	});
+
+	// Both runtime errors are retried, the logic error fails the stream
+	while(cpFailing.count() < 3 && cpFailing.wait(100)) {}
+	if(cpFailure.count() < 1) QVERIFY(cpFailure.wait(100));
+	QVERIFY(!cpFailing.wait(50));
+	QCOMPARE(cpFailing.count(), 3);
+	QCOMPARE(failedType, exception::OutOfRange::type());
+}
@@ -0,0 +1,71 @@
+#include "QuickStreamsTest.hpp"
+#include <string>
+
+// Verify a sequence template can be instantiated multiple times
+// and each instance is executed independently in the right order
+// and fails independently of the other instances
+void QuickStreamsTest::template_instantiate() {
+	Trigger cpFailure;
+	QList<QString> failures;
+
+	SequenceTemplate sequence;
+	sequence
+		.attach([](const QVariant& data) {
+			return QVariant(data.toInt() + 1);
+		})
+		.bind([](const QVariant& data) {
+			return QVariant(data.toInt() * 10);
+		})
+		.attach([](const QVariant& data) {
+			if(data.toInt() > 100) throw std::runtime_error(
+				"too large: " + std::to_string(data.toInt())
+			);
+			return QVariant(data.toInt() + 2);
+		})
+		.failure([&](const QVariant& error) {
+			failures.append(error.value<Error>().message());
+			cpFailure.trigger();
+			return QVariant();
+		});
+	QCOMPARE(sequence.size(), 3);
+
+	// Instantiate the template on top of three independent head streams,
+	// the data of the last one makes the third templated step throw
+	const QList<int> inputs({0, 1, 10});
+	QList<int> results;
+	Trigger cpLast;
+	for(int itr(0); itr < inputs.size(); ++itr) {
+		const int input(inputs.at(itr));
+		auto head = streams->create([input](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			stream.close(input);
+		});
+		sequence.instantiate(head)->attach([&](const QVariant& data) {
+			results.append(data.toInt());
+			cpLast.trigger();
+			return QVariant();
+		});
+	}
+
+	// Each instance created its own streams including the failure stream
+	QCOMPARE(streams->totalCreated(), quint64(3 * (1 + 3 + 1 + 1)));
+
+	// All instances may finish in the same event loop cycle
+	while(cpLast.count() < 2 && cpLast.wait(50)) {}
+	if(cpFailure.count() < 1) QVERIFY(cpFailure.wait(50));
+
+	// Ensure only the instance that threw failed
+	// while the other instances weren't affected
+	QVERIFY(!cpFailure.wait(50));
+	QCOMPARE(cpFailure.count(), 1);
+	QCOMPARE(failures.size(), 1);
+	QVERIFY(failures.first().contains("110"));
+	QCOMPARE(cpLast.count(), 2);
+
+	// Ensure the data passed through all templated streams
+	QCOMPARE(results.size(), 2);
+	QVERIFY(results.contains(12));
+	QVERIFY(results.contains(22));
+}
@@ -0,0 +1,47 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify a timed out trial that eventually closes
+// doesn't settle the retrial with its stale data
+void QuickStreamsTest::timeout_lateClose() {
+	Trigger cpAttached;
+	Trigger cpStale;
+	int counter(0);
+	QVariant passedData;
+
+	auto timedStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		++counter;
+
+		// The first trial answers only after it timed out
+		// and before the retrial answers
+		if(counter < 2) {
+			QTimer::singleShot(40, [&, stream] {
+				stream.close("stale");
+				cpStale.trigger();
+			});
+			return;
+		}
+		QTimer::singleShot(60, [stream] {
+			stream.close("fresh");
+		});
+	});
+
+	timedStream->timeout(20);
+	timedStream->retry({exception::TimeoutError::type()}, 1);
+
+	timedStream->attach([&](const QVariant& data) {
+		passedData = data;
+		cpAttached.trigger();
+		return QVariant();
+	});
+
+	QVERIFY(cpStale.wait(100));
+	QVERIFY(cpAttached.wait(150));
+	QVERIFY(!cpAttached.wait(50));
+
+	QCOMPARE(counter, 2);
+	QCOMPARE(cpAttached.count(), 1);
+	QCOMPARE(passedData.toString(), QString("fresh"));
+}
@@ -0,0 +1,71 @@
+#include "QuickStreamsTest.hpp"
+
+// Verify the timeout operator fails a stuck trial with a timeout error
+// aborting its abortable subordinate stream and that the timed out stream
+// is retried by the error type before it finally closes
+void QuickStreamsTest::timeout_retry() {
+	Trigger cpTrial;
+	Trigger cpSubordinate;
+	Trigger cpAttached;
+	Trigger cpFailure;
+	int counter(0);
+	bool subordinateAborted(false);
+	QVariant passedData;
+
+	auto timedStream = streams->create([&](
+		const StreamHandle& stream, const QVariant& data
+	) {
+		Q_UNUSED(data)
+		++counter;
+		cpTrial.trigger();
+		// Settle the retrial in time but only after the subordinate stream
+		// of the first trial verified its abortion
+		if(counter > 1) {
+			QTimer::singleShot(60, [stream, counter] {
+				stream.close(counter);
+			});
+			return;
+		}
+
+		// Get stuck on the first trial waiting for a subordinate stream
+		// that only closes after it was aborted
+		stream.adopt(streams->create([&](
+			const StreamHandle& stream, const QVariant& data
+		) {
+			Q_UNUSED(data)
+			QTimer::singleShot(40, [&, stream] {
+				subordinateAborted = stream.isAborted();
+				stream.close();
+				cpSubordinate.trigger();
+			});
+		}, Stream::Type::Abortable));
+	});
+
+	timedStream->timeout(20);
+	timedStream->retry({exception::TimeoutError::type()}, 1);
+
+	timedStream->attach([&](const QVariant& data) {
+		passedData = data;
+		cpAttached.trigger();
+		return QVariant();
+	});
+
+	timedStream->failure([&](const QVariant& error) {
+		Q_UNUSED(error)
+		cpFailure.trigger();
+		return QVariant();
+	});
+
+	// Verify the initial trial and the retrial after the timeout
+	QVERIFY(cpTrial.wait(100));
+	QVERIFY(cpTrial.wait(100));
+	QVERIFY(cpSubordinate.wait(100));
+	QVERIFY(cpAttached.wait(150));
+	QVERIFY(!cpFailure.wait(50));
+
+	QCOMPARE(cpTrial.count(), 2);
+	QCOMPARE(cpAttached.count(), 1);
+	QCOMPARE(cpFailure.count(), 0);
+	QCOMPARE(passedData.toInt(), 2);
+	QVERIFY(subordinateAborted);
+}
@@ -0,0 +1,40 @@
+#include "QuickStreamsTest.hpp"
+#include <QElapsedTimer>
+
+// Verify a timer on a higher level of the wheel expires in time
+// even though a later timer occupies the lowest level
+void QuickStreamsTest::timerWheel_mixedLevels() {
+	TimerWheel wheel;
+	TimerWheel::Timer early;
+	TimerWheel::Timer upper;
+	TimerWheel::Timer lower;
+	QElapsedTimer clock;
+	Trigger cpLower;
+	qint64 upperExpired(-1);
+	qint64 lowerExpired(-1);
+
+	// The upper timer is placed on the second level while the early timer
+	// advances the wheel close to the next cascade
+	upper.setCallback([&]() {
+		upperExpired = clock.elapsed();
+	});
+	lower.setCallback([&]() {
+		lowerExpired = clock.elapsed();
+		cpLower.trigger();
+	});
+	early.setCallback([&]() {
+		// Placed on the lowest level but due after the upper timer
+		wheel.schedule(&lower, 40);
+	});
+
+	clock.start();
+	wheel.schedule(&upper, 70);
+	wheel.schedule(&early, 60);
+
+	QVERIFY(cpLower.wait(300));
+
+	// Ensure the upper timer didn't wait for the lower one
+	QVERIFY(upperExpired >= 0);
+	QVERIFY(upperExpired < lowerExpired);
+	QVERIFY(upperExpired < 90);
+}
@@ -0,0 +1,62 @@
+#include "QuickStreamsTest.hpp"
+#include <QByteArray>
+
+static int typedPayloadCopies(0);
+
+// Counts its copies, moving it is free
+struct TypedPayload {
+	QByteArray data;
+
+	TypedPayload() {}
+	TypedPayload(const TypedPayload& other) : data(other.data) {
+		++typedPayloadCopies;
+	}
+	TypedPayload(TypedPayload&& other) : data(std::move(other.data)) {}
+	TypedPayload& operator=(const TypedPayload& other) {
+		data = other.data;
+		++typedPayloadCopies;
+		return *this;
+	}
+	TypedPayload& operator=(TypedPayload&& other) {
+		data = std::move(other.data);
+		return *this;
+	}
+};
+
+// Verify typed streams move their values from step to step
+// without ever copying them
+void QuickStreamsTest::typed_moveChain() {
+	Trigger cpLast;
+	int result(0);
+	typedPayloadCopies = 0;
+
+	auto source(TypedStream<TypedPayload>::create(streams, [](
+		const TypedHandle<TypedPayload>& stream
+	) {
+		TypedPayload payload;
+		payload.data = QByteArray(1024, 'x');
+		stream.close(std::move(payload));
+	}));
+
+	source
+		.attach([](TypedPayload&& payload) {
+			payload.data.append('y');
+			return std::move(payload);
+		})
+		.attachAsync<TypedPayload>([](
+			TypedPayload&& payload,
+			const TypedHandle<TypedPayload>& stream
+		) {
+			payload.data.append('z');
+			stream.close(std::move(payload));
+		})
+		.attach([&](TypedPayload&& payload) {
+			result = payload.data.size();
+			cpLast.trigger();
+			return result;
+		});
+
+	QVERIFY(cpLast.wait(100));
+	QCOMPARE(result, 1026);
+	QCOMPARE(typedPayloadCopies, 0);
+}